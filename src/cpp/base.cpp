@@ -30,6 +30,8 @@ namespace statiskit
 
         boost::mt19937& get_random_generator()
         { return _random_generator; }
+
+        unsigned int _nb_threads = 1;
     }
     
     void set_seed()
@@ -38,6 +40,16 @@ namespace statiskit
     void set_seed(const Index& seed)
     { __impl::_random_generator.seed(seed); }
 
+    unsigned int get_nb_threads()
+    { return __impl::_nb_threads; }
+
+    void set_nb_threads(const unsigned int& nb_threads)
+    {
+        if(nb_threads == 0)
+        { throw lower_bound_error("nb_threads", 0, 0, true); }
+        __impl::_nb_threads = nb_threads;
+    }
+
     not_implemented_error::not_implemented_error(const std::string& function) : std::runtime_error("'" + function + "' is not yet implemented")
     {}
 
@@ -16,10 +16,16 @@
 #include <boost/math/constants/constants.hpp>
 #include <type_traits>
 #include <map>
+#include <algorithm>
+#include <numeric>
 #include <exception>
 #include <assert.h>
 #include <iostream>
 #include <memory>
+#include <thread>
+#include <mutex>
+#include <list>
+#include <unordered_map>
 
 #if defined WIN32 || defined _WIN32 || defined __CYGWIN__
   #ifdef LIBSTATISKIT_CORE
@@ -71,11 +77,25 @@ namespace statiskit
          * The random generator used is the <a href="http://www.boost.org/doc/libs/1_60_0/doc/html/boost/random/mt19937.html">Mersenne Twister</a> random generator of the Boost.Random library
          */
         STATISKIT_CORE_API boost::mt19937& get_random_generator();
+
+        /** Call a function on each index of a range
+         *
+         * The range is split into contiguous blocks processed by at most \ref ::statiskit::get_nb_threads threads.
+         * The first exception thrown by a block is rethrown once all threads are joined.
+         */
+        template<class F> void parallel_for(const Index& size, const F& function);
     }
 
     STATISKIT_CORE_API void set_seed();
     STATISKIT_CORE_API void set_seed(const Index& seed);
 
+    /** Get the maximal number of threads used by parallel computations
+     *
+     * The default is 1 since distributions or estimators may be derived in Python.
+     */
+    STATISKIT_CORE_API unsigned int get_nb_threads();
+    STATISKIT_CORE_API void set_nb_threads(const unsigned int& nb_threads);
+
     struct STATISKIT_CORE_API not_implemented_error : std::runtime_error
     { not_implemented_error(const std::string& function); };
 
@@ -77,6 +77,42 @@ namespace statiskit
                 ++keep_first;
             }
         }
+
+        template<class F>
+            void parallel_for(const Index& size, const F& function)
+            {
+                Index nb_threads = std::min< Index >(get_nb_threads(), size);
+                if(nb_threads < 2)
+                {
+                    for(Index index = 0; index < size; ++index)
+                    { function(index); }
+                }
+                else
+                {
+                    std::vector< std::thread > threads;
+                    std::vector< std::exception_ptr > exceptions(nb_threads);
+                    for(Index thread = 0; thread < nb_threads; ++thread)
+                    {
+                        threads.push_back(std::thread([&size, &function, &exceptions, nb_threads, thread]()
+                        {
+                            try
+                            {
+                                for(Index index = thread * size / nb_threads, max_index = (thread + 1) * size / nb_threads; index < max_index; ++index)
+                                { function(index); }
+                            }
+                            catch(...)
+                            { exceptions[thread] = std::current_exception(); }
+                        }));
+                    }
+                    for(Index thread = 0; thread < nb_threads; ++thread)
+                    { threads[thread].join(); }
+                    for(Index thread = 0; thread < nb_threads; ++thread)
+                    {
+                        if(exceptions[thread])
+                        { std::rethrow_exception(exceptions[thread]); }
+                    }
+                }
+            }
     }
 
     template<typename T, typename L>
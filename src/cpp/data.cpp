@@ -8,8 +8,111 @@
 
 #include "data.h"
 
+#include <boost/functional/hash.hpp>
+
 namespace statiskit
 { 
+    namespace __impl
+    {
+        template<class E>
+            void hash_combine(std::size_t& seed, const UnivariateEvent* event)
+            {
+                boost::hash_combine(seed, event->get_event());
+                switch(event->get_event())
+                {
+                    case ELEMENTARY:
+                        boost::hash_combine(seed, static_cast< const ElementaryEvent< E >* >(event)->get_value());
+                        break;
+                    case CENSORED:
+                        boost::hash_range(seed, static_cast< const CensoredEvent< E >* >(event)->get_values().cbegin(), static_cast< const CensoredEvent< E >* >(event)->get_values().cend());
+                        break;
+                    case LEFT:
+                        boost::hash_combine(seed, static_cast< const LeftCensoredEvent< E >* >(event)->get_upper_bound());
+                        break;
+                    case RIGHT:
+                        boost::hash_combine(seed, static_cast< const RightCensoredEvent< E >* >(event)->get_lower_bound());
+                        break;
+                    case INTERVAL:
+                        boost::hash_combine(seed, static_cast< const IntervalCensoredEvent< E >* >(event)->get_lower_bound());
+                        boost::hash_combine(seed, static_cast< const IntervalCensoredEvent< E >* >(event)->get_upper_bound());
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+        void hash_combine(std::size_t& seed, const UnivariateEvent* event)
+        {
+            if(event)
+            {
+                boost::hash_combine(seed, event->get_outcome());
+                switch(event->get_outcome())
+                {
+                    case CATEGORICAL:
+                        hash_combine< CategoricalEvent >(seed, event);
+                        break;
+                    case DISCRETE:
+                        hash_combine< DiscreteEvent >(seed, event);
+                        break;
+                    case CONTINUOUS:
+                        hash_combine< ContinuousEvent >(seed, event);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            else
+            { boost::hash_combine(seed, -1); }
+        }
+
+        void hash_combine(std::size_t& seed, const UnivariateSampleSpace* sample_space)
+        {
+            boost::hash_combine(seed, sample_space->get_outcome());
+            boost::hash_combine(seed, sample_space->get_ordering());
+            switch(sample_space->get_outcome())
+            {
+                case CATEGORICAL:
+                    {
+                        const CategoricalSampleSpace* categorical = static_cast< const CategoricalSampleSpace* >(sample_space);
+                        boost::hash_range(seed, categorical->get_values().cbegin(), categorical->get_values().cend());
+                        boost::hash_combine(seed, categorical->get_encoding());
+                        if(sample_space->get_ordering() == TOTAL)
+                        {
+                            std::vector< std::string > ordered = static_cast< const OrdinalSampleSpace* >(sample_space)->get_ordered();
+                            boost::hash_range(seed, ordered.cbegin(), ordered.cend());
+                        }
+                        else
+                        { boost::hash_combine(seed, static_cast< const NominalSampleSpace* >(sample_space)->get_reference()); }
+                    }
+                    break;
+                case DISCRETE:
+                    {
+                        const IntegerSampleSpace* integer = dynamic_cast< const IntegerSampleSpace* >(sample_space);
+                        if(integer)
+                        {
+                            boost::hash_combine(seed, integer->get_lower_bound());
+                            boost::hash_combine(seed, integer->get_upper_bound());
+                        }
+                    }
+                    break;
+                case CONTINUOUS:
+                    {
+                        const RealSampleSpace* real = dynamic_cast< const RealSampleSpace* >(sample_space);
+                        if(real)
+                        {
+                            boost::hash_combine(seed, real->get_lower_bound());
+                            boost::hash_combine(seed, real->get_upper_bound());
+                            boost::hash_combine(seed, real->get_left_closed());
+                            boost::hash_combine(seed, real->get_right_closed());
+                        }
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
     double UnivariateData::compute_total() const
     {
         double total = 0.;
@@ -22,6 +125,20 @@ namespace statiskit
         return total;
     }
 
+    std::size_t UnivariateData::compute_fingerprint() const
+    {
+        std::size_t seed = 0;
+        __impl::hash_combine(seed, get_sample_space());
+        std::unique_ptr< UnivariateData::Generator > _generator = generator();
+        while(_generator->is_valid())
+        {
+            __impl::hash_combine(seed, _generator->event());
+            boost::hash_combine(seed, _generator->weight());
+            ++(*_generator);
+        }
+        return seed;
+    }
+
     std::unique_ptr< UnivariateEvent > UnivariateData::compute_minimum() const
     {
         std::unique_ptr< UnivariateEvent > minimum;
@@ -363,6 +480,24 @@ namespace statiskit
         return total;
     }
 
+    std::size_t MultivariateData::compute_fingerprint() const
+    {
+        std::size_t seed = 0;
+        const MultivariateSampleSpace* sample_space = get_sample_space();
+        for(Index index = 0, max_index = sample_space->size(); index < max_index; ++index)
+        { __impl::hash_combine(seed, sample_space->get(index)); }
+        std::unique_ptr< MultivariateData::Generator > _generator = generator();
+        while(_generator->is_valid())
+        {
+            const MultivariateEvent* event = _generator->event();
+            for(Index index = 0, max_index = event->size(); index < max_index; ++index)
+            { __impl::hash_combine(seed, event->get(index)); }
+            boost::hash_combine(seed, _generator->weight());
+            ++(*_generator);
+        }
+        return seed;
+    }
+
 
     MultivariateDataFrame::MultivariateDataFrame()
     {
@@ -760,6 +895,9 @@ namespace statiskit
     WeightedMultivariateData::~WeightedMultivariateData()
     {}
 
+    WeightedMultivariateData::WeightedMultivariateData()
+    {}
+
     std::unique_ptr< UnivariateData > WeightedMultivariateData::extract(const Index& index) const
     { return std::make_unique< UnivariateDataExtraction >(this, index); }
 
@@ -42,6 +42,7 @@ namespace statiskit
         virtual std::unique_ptr< UnivariateData > copy() const = 0;
         
         double compute_total() const;
+        std::size_t compute_fingerprint() const;
         std::unique_ptr< UnivariateEvent > compute_minimum() const;
         std::unique_ptr< UnivariateEvent > compute_maximum() const;
     };
@@ -139,6 +140,7 @@ namespace statiskit
         virtual std::unique_ptr< MultivariateData > copy() const = 0;
 
         double compute_total() const;
+        std::size_t compute_fingerprint() const;
         //virtual std::unique_ptr< MultivariateEvent > compute_minimum() const = 0;
         //virtual std::unique_ptr< MultivariateEvent > compute_maximum() const = 0;
     };
@@ -328,7 +330,7 @@ namespace statiskit
 
             const D* get_data() const;
 
-            Index get_nb_weights() const;
+            virtual Index get_nb_weights() const;
 
             virtual double get_weight(const Index& index) const;     
             void set_weight(const Index& index, const double& weight);       
@@ -383,6 +385,8 @@ namespace statiskit
             virtual std::unique_ptr< MultivariateData > extract(const Indices& indices) const;
 
         protected:       
+            WeightedMultivariateData();
+
 
             template<class D>
             class DataExtraction : public D
@@ -103,7 +103,7 @@ namespace statiskit
 
     template<class D>
         double WeightedData< D >::Generator::weight() const
-        { return _data->_weights[_index]; }
+        { return _data->get_weight(_index); }
 
     template<class D>
         void WeightedData< D >::Generator::weight(const double& weight)
@@ -169,7 +169,7 @@ namespace statiskit
 
     template<class D>     
         double WeightedMultivariateData::DataExtraction< D >::Generator::weight() const
-        { return _data->_weights->_weights[_index]; }
+        { return _data->_weights->get_weight(_index); }
 
     /*template<class D>
         DataMask< D >::DataMask(const std::shared_ptr< D >& masked)
@@ -696,6 +696,7 @@ namespace statiskit
         assert(bins.size() > 1);
         assert(bins.size() == densities.size()+1);
         _bins = bins;
+        _edges = std::vector<double>(bins.cbegin(), bins.cend());
         _densities = densities;
         normalize();
     }
@@ -703,7 +704,11 @@ namespace statiskit
     UnivariateHistogramDistribution::UnivariateHistogramDistribution(const UnivariateHistogramDistribution& histogram)
     {
         _bins = histogram._bins;
+        _edges = histogram._edges;
         _densities = histogram._densities;
+        _cumulatives = histogram._cumulatives;
+        _probabilities = histogram._probabilities;
+        _aliases = histogram._aliases;
     }
 
     UnivariateHistogramDistribution::~UnivariateHistogramDistribution()
@@ -718,65 +723,30 @@ namespace statiskit
     const std::vector<double>& UnivariateHistogramDistribution::get_densities() const
     { return _densities; }
 
-    /*double UnivariateHistogramDistribution::get_bin(const event_type& event) const
-    { 
-        double bin;
-        if(boost::get<double>(event) < *(bins.begin()))
-        { bin = -1*INFINITY; }
-        else if(boost::get<double>(event) > *(bins.rbegin()))
-        { bin = INFINITY ; }
-        else
-        {
-            std::set<double>::const_iterator it = bins.upper_bound(boost::get<double>(event));
-            if(it == bins.end())
-            { --it; }
-            --it;
-            bin = *it;
-        }
-        return bin;
-    }*/
-
     double UnivariateHistogramDistribution::ldf(const double& value) const
     { return log(pdf(value)); }
 
     double UnivariateHistogramDistribution::pdf(const double& value) const
     {
         double p;
-        if(value > *(_bins.rbegin()) || value < *(_bins.begin()))
+        if(value > _edges.back() || value < _edges.front())
         { p = 0; }
         else
-        {
-            std::set<double>::const_iterator it = _bins.upper_bound(value);
-            if(it == _bins.end())
-            { p = _densities.back(); }
-            else
-            {
-                --it;
-                p = _densities[distance(_bins.begin(), it)];
-            }
-        }
+        { p = _densities[locate(value)]; }
         return p;
     }
 
     double UnivariateHistogramDistribution::cdf(const double& value) const
     {
         double cp;
-        if(value <= (*_bins.begin()))
+        if(value <= _edges.front())
         { cp = 0.; }
+        else if(value >= _edges.back())
+        { cp = _cumulatives.back(); }
         else
         {
-            cp = 0.;
-            std::set<double>::const_iterator it = _bins.upper_bound(value);
-            std::set<double>::const_iterator itl = _bins.begin(), itu;
-            itu = itl;
-            ++itu;
-            while(itu != it)
-            {
-                cp += _densities[distance(_bins.begin(), itl)] * (*itu - *itl);
-                ++itl;
-                ++itu;
-            }
-            cp += (value - *itl) * _densities[distance(_bins.begin(), itl)];
+            Index index = locate(value);
+            cp = _cumulatives[index] + (value - _edges[index]) * _densities[index];
         }
         return std::min(cp, 1.);
     }
@@ -785,49 +755,65 @@ namespace statiskit
     {
         double q;
         if(p >= 1.)
-        { q = *(_bins.rbegin()); }
+        { q = _edges.back(); }
         else if (p <= 0.)
-        { q = *(_bins.begin()); }
+        { q = _edges.front(); }
         else
         {
-            std::set<double>::const_iterator itl = _bins.begin(), itu;
-            itu = itl;
-            ++itu;
-            double cum = 0;
-            while(distance(_bins.begin(), itl) < _densities.size() && cum < p)
-            {
-                cum += _densities[distance(_bins.begin(), itl)] * (*itu - *itl);
-                if(cum < p)
-                {
-                    ++itl;
-                    ++itu;
-                }
-            }
-            if(distance(_bins.begin(), itl) == _densities.size())
-            { q = (*_bins.rbegin()); }
+            std::vector<double>::const_iterator it = std::lower_bound(_cumulatives.cbegin() + 1, _cumulatives.cend(), p);
+            if(it == _cumulatives.cend())
+            { q = _edges.back(); }
             else
             {
-                cum -= _densities[distance(_bins.begin(), itl)] * (*itu - *itl);
-                q = *itl + (p - cum) / _densities[distance(_bins.begin(), itl)];
+                Index index = distance(_cumulatives.cbegin() + 1, it);
+                q = _edges[index] + (p - _cumulatives[index]) / _densities[index];
             }
         }
         return q;
     }
 
+    std::vector< double > UnivariateHistogramDistribution::pdf(const std::vector< double >& values) const
+    {
+        std::vector< double > p(values.size());
+        for(Index index = 0, max_index = values.size(); index < max_index; ++index)
+        { p[index] = pdf(values[index]); }
+        return p;
+    }
+
+    std::vector< double > UnivariateHistogramDistribution::cdf(const std::vector< double >& values) const
+    {
+        std::vector< double > cp(values.size());
+        for(Index index = 0, max_index = values.size(); index < max_index; ++index)
+        { cp[index] = cdf(values[index]); }
+        return cp;
+    }
+
+    std::vector< double > UnivariateHistogramDistribution::quantile(const std::vector< double >& p) const
+    {
+        std::vector< double > q(p.size());
+        for(Index index = 0, max_index = p.size(); index < max_index; ++index)
+        { q[index] = quantile(p[index]); }
+        return q;
+    }
+
     std::unique_ptr< UnivariateEvent > UnivariateHistogramDistribution::simulate() const
-    { return std::make_unique< ContinuousElementaryEvent >(quantile(boost::uniform_01<boost::mt19937&>(__impl::get_random_generator())())); }
+    { return std::make_unique< ContinuousElementaryEvent >(draw()); }
+
+    std::vector< double > UnivariateHistogramDistribution::simulate(const Index& size) const
+    {
+        std::vector< double > values(size);
+        for(Index index = 0; index < size; ++index)
+        { values[index] = draw(); }
+        return values;
+    }
 
     double UnivariateHistogramDistribution::get_mean() const
     {
         double mean = 0.;
-        std::set<double>::const_iterator itl = _bins.begin(), itu;
-        itu = itl;
-        ++itl;
-        while(itu != _bins.end())
+        for(Index index = 0, max_index = _densities.size(); index < max_index; ++index)
         {
-            mean += (*itl + (*itu - *itl) / 2.) * _densities[distance(_bins.begin(), itl)];
-            ++itl;
-            ++itu;
+            double length = _edges[index + 1] - _edges[index];
+            mean += (_edges[index] + length / 2.) * _densities[index] * length;
         }
         return mean;
     }
@@ -835,14 +821,10 @@ namespace statiskit
     double UnivariateHistogramDistribution::get_variance() const
     {
         double mean = get_mean(), variance = 0.;
-        std::set<double>::const_iterator itl = _bins.begin(), itu;
-        itu = itl;
-        ++itl;
-        while(itu != _bins.end())
+        for(Index index = 0, max_index = _densities.size(); index < max_index; ++index)
         {
-            variance += pow((*itl + (*itu - *itl) / 2.) - mean, 2) * _densities[distance(_bins.begin(), itl)];
-            ++itl;
-            ++itu;
+            double length = _edges[index + 1] - _edges[index];
+            variance += (pow((_edges[index] + length / 2.) - mean, 2) + pow(length, 2) / 12.) * _densities[index] * length;
         }
         return variance;
     }
@@ -850,20 +832,64 @@ namespace statiskit
     void UnivariateHistogramDistribution::normalize()
     {
         double sum = 0.;
-        std::set<double>::const_iterator itl = _bins.begin(), itu;
-        itu = itl;
-        ++itu;
-        while(itu != _bins.end())
-        { 
-            sum += (*itu - *itl) * _densities[distance(_bins.begin(), itl)];
-            ++itl;
-            ++itu;
-        }
+        for(Index index = 0, max_index = _densities.size(); index < max_index; ++index)
+        { sum += (_edges[index + 1] - _edges[index]) * _densities[index]; }
         if(sum != 1.)
         { 
-            for(unsigned int i = 0; i < _densities.size(); ++i)
-            { _densities[i] /= sum; }
+            for(Index index = 0, max_index = _densities.size(); index < max_index; ++index)
+            { _densities[index] /= sum; }
         }
+        _cumulatives = std::vector<double>(_densities.size() + 1, 0.);
+        for(Index index = 0, max_index = _densities.size(); index < max_index; ++index)
+        { _cumulatives[index + 1] = _cumulatives[index] + _densities[index] * (_edges[index + 1] - _edges[index]); }
+        // Walker's alias table for constant time bin sampling
+        Index nb_bins = _densities.size();
+        _probabilities = std::vector<double>(nb_bins);
+        _aliases = std::vector<Index>(nb_bins);
+        std::vector<Index> smalls, larges;
+        for(Index index = 0; index < nb_bins; ++index)
+        {
+            _probabilities[index] = nb_bins * _densities[index] * (_edges[index + 1] - _edges[index]);
+            _aliases[index] = index;
+            if(_probabilities[index] < 1.)
+            { smalls.push_back(index); }
+            else
+            { larges.push_back(index); }
+        }
+        while(!smalls.empty() && !larges.empty())
+        {
+            Index small = smalls.back(), large = larges.back();
+            smalls.pop_back();
+            _aliases[small] = large;
+            _probabilities[large] -= 1. - _probabilities[small];
+            if(_probabilities[large] < 1.)
+            {
+                larges.pop_back();
+                smalls.push_back(large);
+            }
+        }
+        for(Index index = 0, max_index = larges.size(); index < max_index; ++index)
+        { _probabilities[larges[index]] = 1.; }
+        for(Index index = 0, max_index = smalls.size(); index < max_index; ++index)
+        { _probabilities[smalls[index]] = 1.; }
+    }
+
+    Index UnivariateHistogramDistribution::locate(const double& value) const
+    {
+        Index index = distance(_edges.cbegin(), std::upper_bound(_edges.cbegin(), _edges.cend(), value));
+        if(index == _edges.size())
+        { --index; }
+        return index - 1;
+    }
+
+    double UnivariateHistogramDistribution::draw() const
+    {
+        boost::uniform_01<boost::mt19937&> simulator(__impl::get_random_generator());
+        double u = simulator() * _densities.size();
+        Index index = std::min< Index >(u, _densities.size() - 1);
+        if(u - index >= _probabilities[index])
+        { index = _aliases[index]; }
+        return _edges[index] + simulator() * (_edges[index + 1] - _edges[index]);
     }
 
     LogisticDistribution::LogisticDistribution() 
@@ -967,10 +993,10 @@ namespace statiskit
     }
 
     double LaplaceDistribution::ldf(const double& value) const
-    { return abs(_mu - value) / _sigma - log(2*_sigma); }
+    { return - fabs(_mu - value) / _sigma - log(2*_sigma); }
     
     double LaplaceDistribution::pdf(const double& value) const
-    { return  0.5 * exp( abs(_mu - value) / _sigma) / _sigma; }
+    { return  0.5 * exp( - fabs(_mu - value) / _sigma) / _sigma; }
 
     double LaplaceDistribution::cdf(const double& value) const
     {
@@ -1135,11 +1161,11 @@ namespace statiskit
     double NonStandardStudentDistribution::quantile(const double& p) const
     { 
     	if(p<0.5)
-    	{ return _mu - _sigma * ( _nu * ( 1-boost::math::ibeta_invb(_nu*0.5, 0.5, 2*p) )/boost::math::ibeta_invb(_nu*0.5, 0.5, 2*p) ) ; }
+    	{ return _mu - _sigma * sqrt( _nu * ( 1-boost::math::ibeta_inv(_nu*0.5, 0.5, 2*p) )/boost::math::ibeta_inv(_nu*0.5, 0.5, 2*p) ) ; }
     	else if(p>0.5)
-    	{ return _mu; }
+    	{ return _mu + _sigma * sqrt( _nu * ( 1-boost::math::ibeta_inv(_nu*0.5, 0.5, 2-2*p) )/boost::math::ibeta_inv(_nu*0.5, 0.5, 2-2*p) ); }
     	else
-    	{ return _mu + _sigma * ( _nu * ( 1-boost::math::ibeta_invb(_nu*0.5, 0.5, 2-2*p) )/boost::math::ibeta_invb(_nu*0.5, 0.5, 2-2*p) ); }   	 
+    	{ return _mu; }
     }
 
     std::unique_ptr< UnivariateEvent > NonStandardStudentDistribution::simulate() const
@@ -1248,11 +1274,11 @@ namespace statiskit
     double GeneralizedStudentDistribution::quantile(const double& p) const
     { 
     	if(p<0.5)
-    	{ return _mu - _sigma * ( _nu * ( 1-boost::math::ibeta_invb(_nu*0.5, 0.5, 2*p) )/boost::math::ibeta_invb(_nu*0.5, 0.5, 2*p) ) ; }
+    	{ return _mu - _sigma * sqrt( _nu * ( 1-boost::math::ibeta_inv(_nu*0.5, 0.5, 2*p) )/boost::math::ibeta_inv(_nu*0.5, 0.5, 2*p) ) ; }
     	else if(p>0.5)
-    	{ return _mu; }
+    	{ return _mu + _sigma * sqrt( _nu * ( 1-boost::math::ibeta_inv(_nu*0.5, 0.5, 2-2*p) )/boost::math::ibeta_inv(_nu*0.5, 0.5, 2-2*p) ); }
     	else
-    	{ return _mu + _sigma * ( _nu * ( 1-boost::math::ibeta_invb(_nu*0.5, 0.5, 2-2*p) )/boost::math::ibeta_invb(_nu*0.5, 0.5, 2-2*p) ); }   	 
+    	{ return _mu; }
     }
 
     std::unique_ptr< UnivariateEvent > GeneralizedStudentDistribution::simulate() const
@@ -1444,9 +1470,33 @@ namespace statiskit
         return values;
     }
 
+    namespace __impl
+    {
+        bool extract(const MultivariateEvent* event, Eigen::Ref< Eigen::Matrix< int, 1, Eigen::Dynamic > > values)
+        {
+            bool valid = event && event->size() == static_cast< Index >(values.size());
+            for(Index component = 0, max_component = values.size(); valid && component < max_component; ++component)
+            {
+                const UnivariateEvent* uevent = event->get(component);
+                if(!uevent)
+                { values[component] = 0; }
+                else if(uevent->get_outcome() == DISCRETE && uevent->get_event() == ELEMENTARY)
+                {
+                    values[component] = static_cast< const DiscreteElementaryEvent* >(uevent)->get_value();
+                    valid = values[component] >= 0;
+                }
+                else
+                { valid = false; }
+            }
+            if(!valid)
+            { values.setZero(); }
+            return valid;
+        }
+    }
+
     MultinomialSplittingDistribution::MultinomialSplittingDistribution(const DiscreteUnivariateDistribution& sum, const Eigen::VectorXd& pi)
     {
-        // _sum = static_cast< DiscreteUnivariateDistribution* >(sum.copy().release());
+        _sum = nullptr;
         set_sum(sum);
         _pi = Eigen::VectorXd::Ones(pi.size());
         set_pi(pi);
@@ -1469,73 +1519,118 @@ namespace statiskit
 
     double MultinomialSplittingDistribution::probability(const MultivariateEvent* event, const bool& logarithm) const
     {
-        double p;
-        if(event && event->size() == get_nb_components())
-        {
-            try
-            {
-                int kappa = 0;
-                for(Index component = 0, max_component = get_nb_components(); component < max_component; ++component)
-                {
-                    const UnivariateEvent* uevent = event->get(component);
-                    if(uevent)
-                    {
-                        if(uevent->get_outcome() == DISCRETE && uevent->get_event() == ELEMENTARY)
-                        { kappa += static_cast< const DiscreteElementaryEvent* >(uevent)->get_value(); }
-                        else
-                        { throw std::exception(); }
-                    }
-                }                
-                p = 0.;
-                double sum = 0.;
-                BinomialDistribution binomial = BinomialDistribution(kappa, 0);
-                const UnivariateEvent* uevent;
-                for(Index component = 0, max_component = get_nb_components() - 1; component < max_component; ++component)
-                {
-                    uevent = event->get(component);
-                    if(uevent)
-                    {
-                        if(uevent->get_outcome() == DISCRETE && uevent->get_event() == ELEMENTARY)
-                        {
-                            int value = static_cast< const DiscreteElementaryEvent* >(uevent)->get_value();
-                            binomial.set_pi(_pi[component] / (1 - sum));
-                            p += binomial.ldf(value);
-                            kappa -= value;
-                        }
-                        else
-                        { throw std::exception(); }
-                    }
-                    sum += _pi[component];
-                    binomial.set_kappa(kappa);
-                }
-                uevent = event->get(get_nb_components() - 1);
-                if(uevent->get_outcome() != DISCRETE || uevent->get_event() != ELEMENTARY || static_cast< const DiscreteElementaryEvent* >(uevent)->get_value() != kappa)
-                { p = log(0.); }
-            }
-            catch(const std::exception& error)
-            { p = log(0.); }
-        }
-        else
-        { p = log(0.); }
+        values_type values(1, get_nb_components());
+        Eigen::Array< bool, Eigen::Dynamic, 1 > valid(1);
+        valid[0] = __impl::extract(event, values.row(0));
+        Eigen::VectorXd lp;
+        compute(values, valid, lp);
+        double p = lp[0];
         if(!logarithm)
         { p = exp(p); }
         return p;
     }
 
+    Eigen::VectorXd MultinomialSplittingDistribution::probability(const MultivariateData& data, const bool& logarithm) const
+    {
+        values_type values;
+        Eigen::Array< bool, Eigen::Dynamic, 1 > valid;
+        Eigen::VectorXd weights, lp;
+        extract(data, values, valid, weights);
+        compute(values, valid, lp);
+        if(!logarithm)
+        { lp = lp.array().exp(); }
+        return lp;
+    }
+
+    double MultinomialSplittingDistribution::loglikelihood(const MultivariateData& data) const
+    {
+        values_type values;
+        Eigen::Array< bool, Eigen::Dynamic, 1 > valid;
+        Eigen::VectorXd weights, lp;
+        extract(data, values, valid, weights);
+        compute(values, valid, lp);
+        return (weights.array() > 0.).select(weights.array() * lp.array(), 0.).sum();
+    }
+
+    void MultinomialSplittingDistribution::extract(const MultivariateData& data, values_type& values, Eigen::Array< bool, Eigen::Dynamic, 1 >& valid, Eigen::VectorXd& weights) const
+    {
+        std::vector< int > _values;
+        std::vector< bool > _valid;
+        std::vector< double > _weights;
+        Eigen::Matrix< int, 1, Eigen::Dynamic > row(get_nb_components());
+        std::unique_ptr< MultivariateData::Generator > generator = data.generator();
+        while(generator->is_valid())
+        {
+            _valid.push_back(__impl::extract(generator->event(), row));
+            _values.insert(_values.end(), row.data(), row.data() + row.size());
+            _weights.push_back(generator->weight());
+            ++(*generator);
+        }
+        values = Eigen::Map< values_type >(_values.data(), _weights.size(), get_nb_components());
+        valid.resize(_valid.size());
+        for(Index index = 0, max_index = _valid.size(); index < max_index; ++index)
+        { valid[index] = _valid[index]; }
+        weights = Eigen::Map< Eigen::VectorXd >(_weights.data(), _weights.size());
+    }
+
+    void MultinomialSplittingDistribution::compute(const values_type& values, const Eigen::Array< bool, Eigen::Dynamic, 1 >& valid, Eigen::VectorXd& lp) const
+    {
+        Eigen::VectorXi sums = values.rowwise().sum();
+        int max_sum = sums.size() > 0 ? sums.maxCoeff() : 0;
+        // Log-factorials are tabulated once for all events, unless the table would be larger than the values
+        std::vector< double > lfactorials;
+        if(max_sum <= 4 * values.size())
+        {
+            lfactorials.resize(max_sum + 1, 0.);
+            for(Index index = 2, max_index = lfactorials.size(); index < max_index; ++index)
+            { lfactorials[index] = lfactorials[index - 1] + log(index); }
+        }
+        auto lfactorial = [&lfactorials](const int& value) -> double
+        { return static_cast< std::size_t >(value) < lfactorials.size() ? lfactorials[value] : boost::math::lgamma(value + 1.); };
+        // The sum distribution is evaluated once per distinct sum
+        std::vector< int > distinct(sums.data(), sums.data() + sums.size());
+        std::sort(distinct.begin(), distinct.end());
+        distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+        std::vector< double > lsums(distinct.size());
+        for(Index index = 0, max_index = distinct.size(); index < max_index; ++index)
+        { lsums[index] = _sum->ldf(distinct[index]); }
+        Eigen::ArrayXXd lvalues(values.rows(), values.cols());
+        lp.resize(values.rows());
+        for(Index index = 0, max_index = values.rows(); index < max_index; ++index)
+        {
+            lp[index] = lsums[std::lower_bound(distinct.cbegin(), distinct.cend(), sums[index]) - distinct.cbegin()] + lfactorial(sums[index]);
+            for(Index component = 0, max_component = values.cols(); component < max_component; ++component)
+            { lvalues(index, component) = lfactorial(values(index, component)); }
+        }
+        Eigen::Array< double, 1, Eigen::Dynamic > lpi = _pi.transpose().array().log();
+        Eigen::ArrayXXd terms = values.cast< double >().array().rowwise() * lpi;
+        lp.array() += ((values.array() > 0).select(terms, 0.) - lvalues).rowwise().sum();
+        lp = valid.select(lp.array(), log(0.)).matrix();
+    }
+
     std::unique_ptr< MultivariateEvent > MultinomialSplittingDistribution::simulate() const
     {
         int kappa = static_cast< DiscreteElementaryEvent* >(_sum->simulate().get())->get_value();
         double sum = 0.;
         BinomialDistribution binomial = BinomialDistribution(kappa, 0);
         VectorEvent* event = new VectorEvent(get_nb_components());
-        for(Index component = 0, max_component = get_nb_components(); component < max_component; ++component)
+        for(Index component = 0, max_component = get_nb_components() - 1; component < max_component; ++component)
         { 
-            binomial.set_pi(_pi[component] / (1 - sum));
-            event->set(component, *(binomial.simulate().get()));
+            double pi = _pi[component] / (1 - sum);
+            if(kappa == 0 || pi <= 0.)
+            { event->set(component, DiscreteElementaryEvent(0)); }
+            else if(pi >= 1.)
+            { event->set(component, DiscreteElementaryEvent(kappa)); }
+            else
+            {
+                binomial.set_kappa(kappa);
+                binomial.set_pi(pi);
+                event->set(component, *(binomial.simulate().get()));
+            }
             kappa -= static_cast< const DiscreteElementaryEvent* >(event->get(component))->get_value();
             sum += _pi[component];
-            binomial.set_kappa(kappa);
         }
+        event->set(get_nb_components() - 1, DiscreteElementaryEvent(kappa));
         return std::unique_ptr< MultivariateEvent >(event);
     }
 
@@ -1546,6 +1641,8 @@ namespace statiskit
     { 
         if(sum.cdf(-1) > 0.)
         { throw parameter_error("sum", "must have a natural numbers subset as support"); }
+        if(_sum)
+        { delete _sum; }
         _sum = static_cast< DiscreteUnivariateDistribution* >(sum.copy().release()); 
     }
 
@@ -1644,38 +1741,65 @@ namespace statiskit
 
     int DiscreteUnivariateMixtureDistribution::quantile(const double& p) const
     {
-        int lv = _observations[0]->quantile(p);
-        int rv = lv;
+        int lv = _observations[0]->quantile(p), rv = lv;
         for(Index index = 1, max_index = get_nb_states(); index < max_index; ++index)
         {
             int current = _observations[index]->quantile(p);
-            if(current < lv)
-            { lv = current; }
-            else if(current > rv)
-            { rv = current; }
+            lv = std::min(lv, current);
+            rv = std::max(rv, current);
         }
-        --lv;
-        while(cdf(lv) >= p)
-        { --lv; }
-        ++rv;
-        while(cdf(rv) <= p)
-        { ++rv; }
-        double lp = cdf(lv), rp = cdf(rv);
-        do
+        return quantile(p, lv - 1, rv);
+    }
+
+    std::vector< int > DiscreteUnivariateMixtureDistribution::quantile(const std::vector< double >& p) const
+    {
+        std::vector< Index > order(p.size());
+        for(Index index = 0, max_index = p.size(); index < max_index; ++index)
+        { order[index] = index; }
+        std::sort(order.begin(), order.end(), [&p](const Index& lhs, const Index& rhs) { return p[lhs] < p[rhs]; });
+        std::vector< int > values(p.size());
+        int previous = std::numeric_limits< int >::min();
+        for(Index index = 0, max_index = order.size(); index < max_index; ++index)
         {
-            int mv = (rv + lv)/2;
-            double mp = cdf(mv);
-            if(mp < p)
+            const double& _p = p[order[index]];
+            int lv = _observations[0]->quantile(_p), rv = lv;
+            for(Index state = 1, max_state = get_nb_states(); state < max_state; ++state)
             {
-                lv = mv;
-                lp = mp;
+                int current = _observations[state]->quantile(_p);
+                lv = std::min(lv, current);
+                rv = std::max(rv, current);
             }
+            if(previous > lv)
+            { lv = previous; }
+            values[order[index]] = quantile(_p, lv - 1, rv);
+            previous = values[order[index]];
+        }
+        return values;
+    }
+
+    int DiscreteUnivariateMixtureDistribution::quantile(const double& p, int lv, int rv) const
+    {
+        // Bisection requires cdf(lv) < p <= cdf(rv), the bracket is widened with doubling steps while it is not satisfied
+        int step = 1;
+        while(cdf(lv) >= p && lv > std::numeric_limits< int >::min() + step)
+        {
+            lv -= step;
+            step = std::min(2 * step, std::numeric_limits< int >::max() / 4);
+        }
+        step = 1;
+        while(cdf(rv) < p && rv < std::numeric_limits< int >::max() - step)
+        {
+            rv += step;
+            step = std::min(2 * step, std::numeric_limits< int >::max() / 4);
+        }
+        while(rv - lv > 1)
+        {
+            int mv = lv + (rv - lv) / 2;
+            if(cdf(mv) < p)
+            { lv = mv; }
             else
-            {
-                rv = mv;
-                rp = mp;
-            }
-        } while(rv - lv > 1);
+            { rv = mv; }
+        }
         return rv;
     }
 
@@ -1696,33 +1820,83 @@ namespace statiskit
 
     double ContinuousUnivariateMixtureDistribution::quantile(const double& p) const
     {
-        double lv = _observations[0]->quantile(p);
-        double rv = lv;
+        double lv = _observations[0]->quantile(p), rv = lv;
         for(Index index = 1, max_index = get_nb_states(); index < max_index; ++index)
         {
-            double current = _observations[0]->quantile(p);
-            if(current < lv)
-            { lv = current; }
-            else if(current > rv)
-            { rv = current; }
+            double current = _observations[index]->quantile(p);
+            lv = std::min(lv, current);
+            rv = std::max(rv, current);
         }
-        double lp = cdf(lv), rp = cdf(rv);
-        do
+        return quantile(p, lv, rv);
+    }
+
+    std::vector< double > ContinuousUnivariateMixtureDistribution::quantile(const std::vector< double >& p) const
+    {
+        std::vector< Index > order(p.size());
+        for(Index index = 0, max_index = p.size(); index < max_index; ++index)
+        { order[index] = index; }
+        std::sort(order.begin(), order.end(), [&p](const Index& lhs, const Index& rhs) { return p[lhs] < p[rhs]; });
+        std::vector< double > values(p.size());
+        double previous = -1 * std::numeric_limits< double >::infinity();
+        for(Index index = 0, max_index = order.size(); index < max_index; ++index)
         {
-            int mv = (rv + lv)/2;
-            double mp = cdf(mv);
-            if(mp < p)
+            const double& _p = p[order[index]];
+            double lv = _observations[0]->quantile(_p), rv = lv;
+            for(Index state = 1, max_state = get_nb_states(); state < max_state; ++state)
             {
-                lv = mv;
-                lp = mp;
+                double current = _observations[state]->quantile(_p);
+                lv = std::min(lv, current);
+                rv = std::max(rv, current);
             }
+            values[order[index]] = quantile(_p, std::max(lv, std::min(previous, rv)), rv);
+            previous = values[order[index]];
+        }
+        return values;
+    }
+
+    double ContinuousUnivariateMixtureDistribution::quantile(const double& p, double lv, double rv) const
+    {
+        // Bisection requires cdf(lv) <= p <= cdf(rv), the bracket is widened with doubling steps while it is not satisfied
+        if(p <= 0.)
+        { return lv; }
+        else if(p >= 1.)
+        { return rv; }
+        double step = std::max(rv - lv, _epsilon);
+        while(cdf(lv) > p && boost::math::isfinite(lv))
+        {
+            lv -= step;
+            step *= 2.;
+        }
+        step = std::max(rv - lv, _epsilon);
+        while(cdf(rv) < p && boost::math::isfinite(rv))
+        {
+            rv += step;
+            step *= 2.;
+        }
+        if(!(rv - lv > _epsilon))
+        { return rv; }
+        double mv = lv + (rv - lv) / 2.;
+        // In far tails the spacing of doubles can exceed the tolerance, the midpoint must therefore stay strictly inside the bracket
+        while(rv - lv > _epsilon && lv < mv && mv < rv)
+        {
+            double mp = cdf(mv) - p;
+            if(mp < 0.)
+            { lv = mv; }
+            else if(mp > 0.)
+            { rv = mv; }
+            else
+            { break; }
+            double step = mp / pdf(mv), nv = mv - step;
+            if(!boost::math::isfinite(nv) || nv <= lv || nv >= rv)
+            { mv = lv + (rv - lv) / 2.; }
             else
             {
-                rv = mv;
-                rp = mp;
-            } 
-        } while(rv - lv > _epsilon);
-        return rv;
+                mv = nv;
+                if(fabs(step) < _epsilon)
+                { break; }
+            }
+        }
+        return mv;
     }
 
     double ContinuousUnivariateMixtureDistribution::get_epsilon() const
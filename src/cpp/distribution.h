@@ -20,6 +20,9 @@
 #include <boost/random/variate_generator.hpp>
 #include <boost/math/special_functions/erf.hpp>
 #include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/digamma.hpp>
+#include <boost/math/special_functions/trigamma.hpp>
+#include <boost/math/tools/toms748_solve.hpp>
 #include <boost/math/special_functions/beta.hpp>
 
 namespace statiskit
@@ -781,7 +784,12 @@ namespace statiskit
 
             virtual double quantile(const double& p) const;
 
+            std::vector< double > pdf(const std::vector< double >& values) const;
+            std::vector< double > cdf(const std::vector< double >& values) const;
+            std::vector< double > quantile(const std::vector< double >& p) const;
+
             virtual std::unique_ptr< UnivariateEvent > simulate() const;
+            std::vector< double > simulate(const Index& size) const;
 
             virtual double get_mean() const;
 
@@ -789,9 +797,16 @@ namespace statiskit
 
         protected:
             std::set<double> _bins;
+            std::vector<double> _edges;
             std::vector<double> _densities;
+            std::vector<double> _cumulatives;
+            std::vector<double> _probabilities;
+            std::vector<Index> _aliases;
 
             void normalize();
+
+            Index locate(const double& value) const;
+            double draw() const;
     };
 
     /** \brief This class LogisticDistribution represents a [logistic distribution](https://en.wikipedia.org/wiki/Logistic_distribution).
@@ -1628,7 +1643,7 @@ namespace statiskit
          *
          * \param data The considered multivariate dataset.
          * */ 
-        double loglikelihood(const MultivariateData& data) const;
+        virtual double loglikelihood(const MultivariateData& data) const;
 
         /// Simulate an elementary event according to the considered univariate distribution.
         virtual std::unique_ptr< MultivariateEvent > simulate() const = 0;
@@ -1659,6 +1674,18 @@ namespace statiskit
 
             virtual double probability(const MultivariateEvent* event, const bool& logarithm) const;
 
+            /** \brief Compute the probabilities of all events of a multivariate dataset
+             *
+             * Events are evaluated at once with the multinomial formula, the log-factorials being shared by all events.
+             * Events with a component that is neither missing nor a non-negative discrete elementary event have a null probability.
+             *
+             * \param data The considered multivariate dataset.
+             * \param logarithm If true, log-probabilities are returned.
+             * */
+            Eigen::VectorXd probability(const MultivariateData& data, const bool& logarithm) const;
+
+            virtual double loglikelihood(const MultivariateData& data) const;
+
             std::unique_ptr< MultivariateEvent > simulate() const;
 
             const DiscreteUnivariateDistribution* get_sum() const;
@@ -1670,6 +1697,11 @@ namespace statiskit
         protected:
             DiscreteUnivariateDistribution* _sum;
             Eigen::VectorXd _pi;
+
+            typedef Eigen::Matrix< int, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > values_type;
+
+            void extract(const MultivariateData& data, values_type& values, Eigen::Array< bool, Eigen::Dynamic, 1 >& valid, Eigen::VectorXd& weights) const;
+            void compute(const values_type& values, const Eigen::Array< bool, Eigen::Dynamic, 1 >& valid, Eigen::VectorXd& lp) const;
     };
 
     struct STATISKIT_CORE_API ContinuousMultivariateDistribution : MultivariateDistribution
@@ -1706,7 +1738,7 @@ namespace statiskit
     template<class D> class IndependentMultivariateDistribution : public PolymorphicCopy< MultivariateDistribution, IndependentMultivariateDistribution< D >, D >
     {
         public:
-            IndependentMultivariateDistribution(const std::vector< typename D::marginal_type >& marginals);
+            IndependentMultivariateDistribution(const std::vector< typename D::marginal_type const * >& marginals);
             IndependentMultivariateDistribution(const IndependentMultivariateDistribution< D >& independent);
             virtual ~IndependentMultivariateDistribution();
             
@@ -1764,12 +1796,23 @@ namespace statiskit
             void set_pi(const Eigen::VectorXd& pi);
 
             Eigen::VectorXd posterior(const typename D::data_type::event_type* event, const bool& logarithm=false) const;
+            Eigen::MatrixXd posterior(const typename D::data_type& data, const bool& logarithm=false) const;
+
+            /** \brief Compute the normalized log-posterior probabilities.
+             *
+             * \details Contrarily to posterior with the boolean parameter logarithm, which only shifts log-probabilities by their maximum, the logarithms of the posterior probabilities are returned.
+             * */
+            Eigen::VectorXd log_posterior(const typename D::data_type::event_type* event) const;
+            Eigen::MatrixXd log_posterior(const typename D::data_type& data) const;
         
             Index assignement(const typename D::data_type::event_type* event) const;
+            std::vector< Index > assignement(const typename D::data_type& data) const;
 
             double uncertainty(const typename D::data_type::event_type* event) const;
             double uncertainty(const typename D::data_type& data) const;
 
+            Eigen::VectorXd uncertainties(const typename D::data_type& data) const;
+
         protected:
             std::vector< D* > _observations;
             Eigen::VectorXd _pi;
@@ -1817,11 +1860,16 @@ namespace statiskit
 
     struct STATISKIT_CORE_API DiscreteUnivariateMixtureDistribution : PolymorphicCopy< UnivariateDistribution, DiscreteUnivariateMixtureDistribution, QuantitativeUnivariateMixtureDistribution< DiscreteUnivariateDistribution > >
     {
-        DiscreteUnivariateMixtureDistribution(const std::vector< DiscreteUnivariateDistribution* > observations, const Eigen::VectorXd& pi);
-        DiscreteUnivariateMixtureDistribution(const DiscreteUnivariateMixtureDistribution& mixture);
-        virtual ~DiscreteUnivariateMixtureDistribution();
+        public:
+            DiscreteUnivariateMixtureDistribution(const std::vector< DiscreteUnivariateDistribution* > observations, const Eigen::VectorXd& pi);
+            DiscreteUnivariateMixtureDistribution(const DiscreteUnivariateMixtureDistribution& mixture);
+            virtual ~DiscreteUnivariateMixtureDistribution();
 
-        virtual int quantile(const double& p) const;
+            virtual int quantile(const double& p) const;
+            std::vector< int > quantile(const std::vector< double >& p) const;
+
+        protected:
+            int quantile(const double& p, int lv, int rv) const;
     };
 
     typedef std::vector< DiscreteUnivariateDistribution* > DiscreteUnivariateDistributionVector;
@@ -1834,12 +1882,15 @@ namespace statiskit
             virtual ~ContinuousUnivariateMixtureDistribution();
 
             virtual double quantile(const double& p) const;
+            std::vector< double > quantile(const std::vector< double >& p) const;
 
             double get_epsilon() const;
             void set_epsilon(const double& epsilon);
 
         protected:
             double _epsilon;
+
+            double quantile(const double& p, double lv, double rv) const;
     };
 
     typedef std::vector< ContinuousUnivariateDistribution* > ContinuousUnivariateDistributionVector;
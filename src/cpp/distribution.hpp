@@ -251,11 +251,15 @@ namespace statiskit
         }
 
     template<class D>
-        IndependentMultivariateDistribution< D >::IndependentMultivariateDistribution(const std::vector< typename D::marginal_type >& marginals)
+        IndependentMultivariateDistribution< D >::IndependentMultivariateDistribution(const std::vector< typename D::marginal_type const * >& marginals)
         {
             _marginals.resize(marginals.size(), nullptr);
             for(Index component = 0, max_component = marginals.size(); component < max_component; ++component)
-            { _marginals[component] = static_cast< typename D::marginal_type* >(marginals[index].copy().release()); }
+            {
+                if(!marginals[component])
+                { throw nullptr_error("marginals"); }
+                _marginals[component] = static_cast< typename D::marginal_type* >(marginals[component]->copy().release());
+            }
         }
 
     template<class D>
@@ -319,7 +323,7 @@ namespace statiskit
     template<class D>
         typename D::marginal_type* IndependentMultivariateDistribution< D >:: get_marginal(const Index& index) const
         {
-            if(index > get_nb_components())
+            if(index >= get_nb_components())
             { throw size_error("index", get_nb_components(), size_error::inferior); }
             return _marginals[index];
         }
@@ -328,7 +332,7 @@ namespace statiskit
     template<class D>
         void IndependentMultivariateDistribution< D >::set_marginal(const Index& index, const typename D::marginal_type& marginal) 
         {
-            if(index > get_nb_components())
+            if(index >= get_nb_components())
             { throw size_error("index", get_nb_components(), size_error::inferior); }
             delete _marginals[index];
             _marginals[index] = static_cast< typename D::marginal_type* >(marginal.copy().release());
@@ -384,7 +388,9 @@ namespace statiskit
         { 
             if(index >= get_nb_states())
             { throw size_error("index", get_nb_states(), size_error::inferior); }
-            _observations[index] = static_cast< D* >(observation.copy().release());
+            D* _observation = static_cast< D* >(observation.copy().release());
+            delete _observations[index];
+            _observations[index] = _observation;
         }     
 
     template<class D>
@@ -426,6 +432,88 @@ namespace statiskit
             return p;
         }
 
+    template<class D>
+        Eigen::MatrixXd MixtureDistribution< D >::posterior(const typename D::data_type& data, const bool& logarithm) const
+        {
+            std::vector< std::vector< double > > columns(this->get_nb_states());
+            __impl::parallel_for(columns.size(), [this, &data, &columns](const Index& state)
+            {
+                double pi = log(this->_pi[state]);
+                std::unique_ptr< typename D::data_type::Generator > generator = data.generator();
+                while(generator->is_valid())
+                {
+                    columns[state].push_back(pi + this->_observations[state]->probability(generator->event(), true));
+                    ++(*generator);
+                }
+            });
+            Eigen::MatrixXd p = Eigen::MatrixXd(columns.front().size(), columns.size());
+            for(Index state = 0, max_state = columns.size(); state < max_state; ++state)
+            { p.col(state) = Eigen::Map< Eigen::VectorXd >(columns[state].data(), columns[state].size()); }
+            columns.clear();
+            for(Index index = 0, max_index = p.rows(); index < max_index; ++index)
+            {
+                double max = p.row(index).maxCoeff(), sum = 0.;
+                for(Index state = 0, max_state = p.cols(); state < max_state; ++state)
+                {
+                    if(boost::math::isfinite(p(index, state)))
+                    {
+                        p(index, state) = p(index, state) - max;
+                        sum += exp(p(index, state));
+                    }
+                }
+                if(!logarithm)
+                {
+                    for(Index state = 0, max_state = p.cols(); state < max_state; ++state)
+                    {
+                        if(boost::math::isfinite(p(index, state)))
+                        { p(index, state) = exp(p(index, state)) / sum; }
+                        else
+                        { p(index, state) = 0.; }
+                    }
+                }
+            }
+            return p;
+        }
+
+    template<class D>
+        Eigen::VectorXd MixtureDistribution< D >::log_posterior(const typename D::data_type::event_type* event) const
+        {
+            Eigen::VectorXd p = posterior(event, true);
+            double sum = 0.;
+            for(Index index = 0, max_index = p.size(); index < max_index; ++index)
+            {
+                if(boost::math::isfinite(p[index]))
+                { sum += exp(p[index]); }
+            }
+            for(Index index = 0, max_index = p.size(); index < max_index; ++index)
+            {
+                if(boost::math::isfinite(p[index]))
+                { p[index] -= log(sum); }
+            }
+            return p;
+        }
+
+    template<class D>
+        Eigen::MatrixXd MixtureDistribution< D >::log_posterior(const typename D::data_type& data) const
+        {
+            Eigen::MatrixXd p = posterior(data, true);
+            for(Index index = 0, max_index = p.rows(); index < max_index; ++index)
+            {
+                double sum = 0.;
+                for(Index state = 0, max_state = p.cols(); state < max_state; ++state)
+                {
+                    if(boost::math::isfinite(p(index, state)))
+                    { sum += exp(p(index, state)); }
+                }
+                for(Index state = 0, max_state = p.cols(); state < max_state; ++state)
+                {
+                    if(boost::math::isfinite(p(index, state)))
+                    { p(index, state) -= log(sum); }
+                }
+            }
+            return p;
+        }
+
     template<class D>
         Index MixtureDistribution< D >::assignement(const typename D::data_type::event_type* event) const
         {
@@ -434,12 +522,22 @@ namespace statiskit
             p.maxCoeff(&index);
             return index;
         }
+
+    template<class D>
+        std::vector< Index > MixtureDistribution< D >::assignement(const typename D::data_type& data) const
+        {
+            Eigen::MatrixXd p = posterior(data, true);
+            std::vector< Index > indices(p.rows());
+            for(Index index = 0, max_index = p.rows(); index < max_index; ++index)
+            { p.row(index).maxCoeff(&indices[index]); }
+            return indices;
+        }
         
     template<class D>
         double MixtureDistribution< D >::uncertainty(const typename D::data_type::event_type* event) const
         {
             double entropy = 0.;
-            Eigen::VectorXd p = posterior(event, true);
+            Eigen::VectorXd p = log_posterior(event);
             for(Index index = 0, max_index = p.size(); index < max_index; ++index)
             {
                 if(boost::math::isfinite(p[index]))
@@ -452,15 +550,34 @@ namespace statiskit
         double MixtureDistribution< D >::uncertainty(const typename D::data_type& data) const
         {
             double entropy = 0.;
+            Eigen::VectorXd entropies = uncertainties(data);
             std::unique_ptr< typename D::data_type::Generator > generator = data.generator();
+            Index index = 0;
             while(generator->is_valid())
             {
-                entropy += generator->weight() * uncertainty(generator->event());
+                entropy += generator->weight() * entropies[index];
+                ++index;
                 ++(*generator);
             }
             return entropy;
         }
 
+    template<class D>
+        Eigen::VectorXd MixtureDistribution< D >::uncertainties(const typename D::data_type& data) const
+        {
+            Eigen::MatrixXd p = log_posterior(data);
+            Eigen::VectorXd entropies = Eigen::VectorXd::Zero(p.rows());
+            for(Index index = 0, max_index = p.rows(); index < max_index; ++index)
+            {
+                for(Index state = 0, max_state = p.cols(); state < max_state; ++state)
+                {
+                    if(boost::math::isfinite(p(index, state)))
+                    { entropies[index] -= exp(p(index, state)) * p(index, state); }
+                }
+            }
+            return entropies;
+        }
+
     template<class D>
         void MixtureDistribution< D >::init(const std::vector< D* > observations, const Eigen::VectorXd& pi)
         {
@@ -14,6 +14,80 @@ namespace statiskit
     underdispersion_error::underdispersion_error() : parameter_error("data", " is underdispersed")
     {}
 
+    UnivariateDataStatistic::UnivariateDataStatistic(const UnivariateSampleSpace& sample_space)
+    { _data = new UnivariateDataFrame(sample_space); }
+
+    UnivariateDataStatistic::UnivariateDataStatistic(const UnivariateDataStatistic& statistic)
+    {
+        _data = new UnivariateDataFrame(*(statistic._data));
+        _weights = statistic._weights;
+    }
+
+    UnivariateDataStatistic::~UnivariateDataStatistic()
+    { delete _data; }
+
+    void UnivariateDataStatistic::update(const UnivariateEvent* event, const double& weight)
+    {
+        _data->add_event(event);
+        _weights.push_back(weight);
+    }
+
+    void UnivariateDataStatistic::reset()
+    {
+        UnivariateDataFrame* data = new UnivariateDataFrame(*(_data->get_sample_space()));
+        delete _data;
+        _data = data;
+        _weights.clear();
+    }
+
+    std::unique_ptr< WeightedUnivariateData > UnivariateDataStatistic::get_data() const
+    {
+        std::unique_ptr< WeightedUnivariateData > data = std::make_unique< WeightedUnivariateData >(_data);
+        for(Index index = 0, max_index = _weights.size(); index < max_index; ++index)
+        { data->set_weight(index, _weights[index]); }
+        return data;
+    }
+
+    MultivariateDataStatistic::MultivariateDataStatistic(const MultivariateSampleSpace& sample_space)
+    {
+        _data = new MultivariateDataFrame();
+        for(Index index = 0, max_index = sample_space.size(); index < max_index; ++index)
+        { _data->add_component(UnivariateDataFrame(*(sample_space.get(index)))); }
+    }
+
+    MultivariateDataStatistic::MultivariateDataStatistic(const MultivariateDataStatistic& statistic)
+    {
+        _data = new MultivariateDataFrame(*(statistic._data));
+        _weights = statistic._weights;
+    }
+
+    MultivariateDataStatistic::~MultivariateDataStatistic()
+    { delete _data; }
+
+    void MultivariateDataStatistic::update(const MultivariateEvent* event, const double& weight)
+    {
+        _data->add_event(event);
+        _weights.push_back(weight);
+    }
+
+    void MultivariateDataStatistic::reset()
+    {
+        MultivariateDataFrame* data = new MultivariateDataFrame();
+        for(Index index = 0, max_index = _data->get_nb_components(); index < max_index; ++index)
+        { data->add_component(UnivariateDataFrame(*(_data->get_component(index)->get_sample_space()))); }
+        delete _data;
+        _data = data;
+        _weights.clear();
+    }
+
+    std::unique_ptr< WeightedMultivariateData > MultivariateDataStatistic::get_data() const
+    {
+        std::unique_ptr< WeightedMultivariateData > data = std::make_unique< WeightedMultivariateData >(_data);
+        for(Index index = 0, max_index = _weights.size(); index < max_index; ++index)
+        { data->set_weight(index, _weights[index]); }
+        return data;
+    }
+
     UnivariateDistributionEstimation::~UnivariateDistributionEstimation()
     {}
 
@@ -83,12 +157,34 @@ namespace statiskit
         return this->operator() (*_data);
     }
 
+    std::unique_ptr< UnivariateDistributionEstimation > UnivariateDistributionEstimation::Estimator::operator() (const statistic_type& statistic) const
+    {
+        const UnivariateDataStatistic* data = dynamic_cast< const UnivariateDataStatistic* >(&statistic);
+        if(!data)
+        { throw parameter_error("statistic", "expected data statistic"); }
+        return (*this)(*(data->get_data()), true);
+    }
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator::statistic_type > UnivariateDistributionEstimation::Estimator::statistic() const
+    { return nullptr; }
+
     MultivariateDistributionEstimation::~MultivariateDistributionEstimation()
     {}
 
     MultivariateDistributionEstimation::Estimator::~Estimator()
     {}
 
+    std::unique_ptr< MultivariateDistributionEstimation > MultivariateDistributionEstimation::Estimator::operator() (const statistic_type& statistic) const
+    {
+        const MultivariateDataStatistic* data = dynamic_cast< const MultivariateDataStatistic* >(&statistic);
+        if(!data)
+        { throw parameter_error("statistic", "expected data statistic"); }
+        return (*this)(*(data->get_data()), true);
+    }
+
+    std::unique_ptr< MultivariateDistributionEstimation::Estimator::statistic_type > MultivariateDistributionEstimation::Estimator::statistic() const
+    { return nullptr; }
+
     std::unique_ptr< UnivariateConditionalDistributionEstimation > UnivariateConditionalDistributionEstimation::Estimator::operator() (const data_type& data, const Index& response, const Indices& explanatories, const bool& lazy) const
     { return operator()(*(data.extract(explanatories).get()), response, lazy); }
 }
@@ -21,6 +21,66 @@ namespace statiskit
     struct STATISKIT_CORE_API underdispersion_error : parameter_error
     { underdispersion_error(); };
 
+    /** Sufficient statistic accumulator
+     *
+     * A sufficient statistic is updated event by event with the corresponding weight.
+     * Estimators that support it can then compute their estimate from the accumulated statistic instead of the data.
+     * Moment statistics are supported by the Poisson and normal ML and the binomial and negative binomial MM estimators.
+     * Any other estimator is fitted on the events accumulated by a data statistic and rejects other statistics.
+     */
+    template<class E> struct SufficientStatistic
+    {
+        typedef E event_type;
+
+        virtual ~SufficientStatistic();
+
+        virtual void update(const E* event, const double& weight) = 0;
+        virtual void reset() = 0;
+
+        virtual std::unique_ptr< SufficientStatistic< E > > copy() const = 0;
+    };
+
+    typedef SufficientStatistic< UnivariateEvent > UnivariateSufficientStatistic;
+    typedef SufficientStatistic< MultivariateEvent > MultivariateSufficientStatistic;
+
+    /** Sufficient statistic of estimators without a closed-form fit
+     *
+     * Events are copied with their weights so that any estimator can be fitted on them.
+     */
+    class STATISKIT_CORE_API UnivariateDataStatistic : public PolymorphicCopy< UnivariateSufficientStatistic, UnivariateDataStatistic >
+    {
+        public:
+            UnivariateDataStatistic(const UnivariateSampleSpace& sample_space);
+            UnivariateDataStatistic(const UnivariateDataStatistic& statistic);
+            virtual ~UnivariateDataStatistic();
+
+            virtual void update(const UnivariateEvent* event, const double& weight);
+            virtual void reset();
+
+            std::unique_ptr< WeightedUnivariateData > get_data() const;
+
+        protected:
+            UnivariateDataFrame* _data;
+            std::vector< double > _weights;
+    };
+
+    class STATISKIT_CORE_API MultivariateDataStatistic : public PolymorphicCopy< MultivariateSufficientStatistic, MultivariateDataStatistic >
+    {
+        public:
+            MultivariateDataStatistic(const MultivariateSampleSpace& sample_space);
+            MultivariateDataStatistic(const MultivariateDataStatistic& statistic);
+            virtual ~MultivariateDataStatistic();
+
+            virtual void update(const MultivariateEvent* event, const double& weight);
+            virtual void reset();
+
+            std::unique_ptr< WeightedMultivariateData > get_data() const;
+
+        protected:
+            MultivariateDataFrame* _data;
+            std::vector< double > _weights;
+    };
+
     struct STATISKIT_CORE_API UnivariateDistributionEstimation
     {
         typedef UnivariateData data_type;
@@ -33,11 +93,15 @@ namespace statiskit
         struct STATISKIT_CORE_API Estimator
         { 
             typedef UnivariateDistributionEstimation estimation_type;
+            typedef UnivariateSufficientStatistic statistic_type;
 
             virtual ~Estimator() = 0;
 
             virtual std::unique_ptr< estimation_type > operator() (const MultivariateData& data, const Index& index) const;
             virtual std::unique_ptr< estimation_type > operator() (const data_type& data, const bool& lazy=true) const = 0;
+            virtual std::unique_ptr< estimation_type > operator() (const statistic_type& statistic) const;
+
+            virtual std::unique_ptr< statistic_type > statistic() const;
 
             virtual std::unique_ptr< Estimator > copy() const = 0;
         };
@@ -122,6 +186,7 @@ namespace statiskit
                     std::vector< typename B::Estimator * > _estimators;
 
                     virtual double scoring(const typename B::estimated_type * estimated, typename B::data_type const & data) const = 0;
+                    virtual std::vector< double > scoring(const std::vector< typename B::estimated_type const * >& estimated, typename B::data_type const & data) const;
 
                     void init();
                     void init(const Estimator& estimator);
@@ -148,6 +213,52 @@ namespace statiskit
                     criterion_type _criterion;
 
                     virtual double scoring(const typename B::estimated_type * estimated, typename B::data_type const & data) const;
+                    virtual std::vector< double > scoring(const std::vector< typename B::estimated_type const * >& estimated, typename B::data_type const & data) const;
+
+                    double penalize(const double& loglikelihood, const unsigned int& nb_parameters, const double& total) const;
+            };
+
+            /** Selection of the candidate with the best mean held-out log-likelihood over random folds
+             *
+             * With early stopping, candidates beaten by the leader on each of the first folds are not fitted on the remaining folds and are given a NaN score.
+             */
+            class CrossValidationEstimator : public PolymorphicCopy< typename B::Estimator::estimation_type::Estimator, CrossValidationEstimator, Estimator >
+            {
+                public:
+                    CrossValidationEstimator();
+                    CrossValidationEstimator(const CrossValidationEstimator& estimator);
+                    virtual ~CrossValidationEstimator();
+
+                    const Index& get_nb_folds() const;
+                    void set_nb_folds(const Index& nb_folds);
+
+                    const Index& get_early_stopping() const;
+                    void set_early_stopping(const Index& early_stopping);
+
+                protected:
+                    Index _nb_folds;
+                    Index _early_stopping;
+
+                    virtual double scoring(const typename B::estimated_type * estimated, typename B::data_type const & data) const;
+                    virtual std::vector< double > scoring(const std::vector< typename B::estimated_type const * >& estimated, typename B::data_type const & data) const;
+
+                    /** Training set of a fold, sharing the fold assignments and weights of the data */
+                    class Fold : public PolymorphicCopy< typename B::data_type, Fold, typename B::data_type::weighted_type >
+                    {
+                        public:
+                            Fold(typename B::data_type const * data, const std::vector< Index >* folds, const std::vector< double >* weights, const Index& fold);
+                            Fold(const Fold& fold);
+                            virtual ~Fold();
+
+                            virtual Index get_nb_weights() const;
+
+                            virtual double get_weight(const Index& index) const;
+
+                        protected:
+                            const std::vector< Index >* _folds;
+                            const std::vector< double >* _shared;
+                            Index _fold;
+                    };
             };
 
         protected:
@@ -157,6 +268,52 @@ namespace statiskit
             void finalize();
     };
 
+    /** Estimator memoizing the distributions estimated by another estimator
+     *
+     * Estimated distributions are stored in a least recently used cache keyed by \ref ::statiskit::UnivariateData::compute_fingerprint (resp. \ref ::statiskit::MultivariateData::compute_fingerprint).
+     * This fingerprint hashes the sample space (including categorical values and their ordering), the events and their weights.
+     * Data are not compared on a hit, so two data sets whose fingerprints collide share the same, possibly stale, estimated distribution.
+     * The wrapped estimator is only exposed as a copy, its configuration therefore only changes with \ref ::statiskit::CachedEstimator::set_estimator which clears the cache.
+     */
+    template<class D, class B> class CachedEstimator : public PolymorphicCopy< typename B::Estimator::estimation_type::Estimator, CachedEstimator< D, B >, typename B::Estimator >
+    {
+        public:
+            CachedEstimator();
+            CachedEstimator(const typename B::Estimator& estimator);
+            CachedEstimator(const CachedEstimator< D, B >& estimator);
+            virtual ~CachedEstimator();
+
+            virtual std::unique_ptr< typename B::Estimator::estimation_type > operator() (typename B::data_type const & data, const bool& lazy=true) const;
+            virtual std::unique_ptr< typename B::Estimator::estimation_type > operator() (typename B::Estimator::statistic_type const & statistic) const;
+
+            virtual std::unique_ptr< typename B::Estimator::statistic_type > statistic() const;
+
+            std::unique_ptr< typename B::Estimator > get_estimator() const;
+            void set_estimator(const typename B::Estimator& estimator);
+
+            Index get_capacity() const;
+            void set_capacity(const Index& capacity);
+
+            Index size() const;
+            void clear();
+
+        protected:
+            struct Cache
+            {
+                typedef std::list< std::pair< std::size_t, std::unique_ptr< typename B::estimated_type > > > entries_type;
+
+                std::mutex mutex;
+                Index capacity;
+                entries_type entries;
+                std::unordered_map< std::size_t, typename entries_type::iterator > positions;
+
+                void insert(const std::size_t& fingerprint, const typename B::estimated_type * estimated);
+            };
+
+            typename B::Estimator * _estimator;
+            std::shared_ptr< Cache > _cache;
+    };
+
     template<class T, class D, class B> class OptimizationEstimationImpl : public ActiveEstimation< D, B >
     {
         public:
@@ -234,6 +391,8 @@ namespace statiskit
 
     typedef Selection< CategoricalUnivariateDistribution, CategoricalUnivariateDistributionEstimation > CategoricalUnivariateDistributionSelection;
     typedef CategoricalUnivariateDistributionSelection::CriterionEstimator CategoricalUnivariateDistributionCriterionEstimator;
+    typedef CategoricalUnivariateDistributionSelection::CrossValidationEstimator CategoricalUnivariateDistributionCrossValidationEstimator;
+    typedef CachedEstimator< CategoricalUnivariateDistribution, CategoricalUnivariateDistributionEstimation > CategoricalUnivariateDistributionCachedEstimator;
 
 
     struct STATISKIT_CORE_API DiscreteUnivariateDistributionEstimation : UnivariateDistributionEstimation
@@ -241,12 +400,16 @@ namespace statiskit
 
     typedef Selection< DiscreteUnivariateDistribution, DiscreteUnivariateDistributionEstimation > DiscreteUnivariateDistributionSelection;
     typedef DiscreteUnivariateDistributionSelection::CriterionEstimator DiscreteUnivariateDistributionCriterionEstimator;
+    typedef DiscreteUnivariateDistributionSelection::CrossValidationEstimator DiscreteUnivariateDistributionCrossValidationEstimator;
+    typedef CachedEstimator< DiscreteUnivariateDistribution, DiscreteUnivariateDistributionEstimation > DiscreteUnivariateDistributionCachedEstimator;
 
     struct STATISKIT_CORE_API ContinuousUnivariateDistributionEstimation : UnivariateDistributionEstimation
     { struct STATISKIT_CORE_API Estimator : UnivariateDistributionEstimation::Estimator {}; };
 
     typedef Selection< ContinuousUnivariateDistribution, ContinuousUnivariateDistributionEstimation > ContinuousUnivariateDistributionSelection;
     typedef ContinuousUnivariateDistributionSelection::CriterionEstimator ContinuousUnivariateDistributionCriterionEstimator;
+    typedef ContinuousUnivariateDistributionSelection::CrossValidationEstimator ContinuousUnivariateDistributionCrossValidationEstimator;
+    typedef CachedEstimator< ContinuousUnivariateDistribution, ContinuousUnivariateDistributionEstimation > ContinuousUnivariateDistributionCachedEstimator;
 
     struct STATISKIT_CORE_API MultivariateDistributionEstimation
     {
@@ -262,10 +425,14 @@ namespace statiskit
         {
             typedef MultivariateDistributionEstimation estimation_type;
             typedef UnivariateDistributionEstimation marginal_type;
+            typedef MultivariateSufficientStatistic statistic_type;
 
             virtual ~Estimator() = 0;
 
             virtual std::unique_ptr< estimation_type > operator() (const data_type& data, const bool& lazy=true) const = 0;
+            virtual std::unique_ptr< estimation_type > operator() (const statistic_type& statistic) const;
+
+            virtual std::unique_ptr< statistic_type > statistic() const;
 
             virtual std::unique_ptr< Estimator > copy() const = 0;
         };
@@ -273,6 +440,8 @@ namespace statiskit
 
     typedef Selection< MultivariateDistribution, MultivariateDistributionEstimation > MixedMultivariateDistributionSelection;
     typedef MixedMultivariateDistributionSelection::CriterionEstimator MixedMultivariateDistributionCriterionEstimator;
+    typedef MixedMultivariateDistributionSelection::CrossValidationEstimator MixedMultivariateDistributionCrossValidationEstimator;
+    typedef CachedEstimator< MultivariateDistribution, MultivariateDistributionEstimation > MixedMultivariateDistributionCachedEstimator;
 
     struct STATISKIT_CORE_API CategoricalMultivariateDistributionEstimation : MultivariateDistributionEstimation
     {
@@ -283,6 +452,8 @@ namespace statiskit
 
     typedef Selection< CategoricalMultivariateDistribution, CategoricalMultivariateDistributionEstimation > CategoricalMultivariateDistributionSelection;
     typedef CategoricalMultivariateDistributionSelection::CriterionEstimator CategoricalMultivariateDistributionCriterionEstimator;
+    typedef CategoricalMultivariateDistributionSelection::CrossValidationEstimator CategoricalMultivariateDistributionCrossValidationEstimator;
+    typedef CachedEstimator< CategoricalMultivariateDistribution, CategoricalMultivariateDistributionEstimation > CategoricalMultivariateDistributionCachedEstimator;
 
     struct STATISKIT_CORE_API DiscreteMultivariateDistributionEstimation : MultivariateDistributionEstimation
     {
@@ -293,6 +464,8 @@ namespace statiskit
 
     typedef Selection< DiscreteMultivariateDistribution, DiscreteMultivariateDistributionEstimation > DiscreteMultivariateDistributionSelection;
     typedef DiscreteMultivariateDistributionSelection::CriterionEstimator DiscreteMultivariateDistributionCriterionEstimator;
+    typedef DiscreteMultivariateDistributionSelection::CrossValidationEstimator DiscreteMultivariateDistributionCrossValidationEstimator;
+    typedef CachedEstimator< DiscreteMultivariateDistribution, DiscreteMultivariateDistributionEstimation > DiscreteMultivariateDistributionCachedEstimator;
 
     struct STATISKIT_CORE_API ContinuousMultivariateDistributionEstimation : MultivariateDistributionEstimation
     {
@@ -303,6 +476,8 @@ namespace statiskit
 
     typedef Selection< ContinuousMultivariateDistribution, ContinuousMultivariateDistributionEstimation > ContinuousMultivariateDistributionSelection;
     typedef ContinuousMultivariateDistributionSelection::CriterionEstimator ContinuousMultivariateDistributionCriterionEstimator;
+    typedef ContinuousMultivariateDistributionSelection::CrossValidationEstimator ContinuousMultivariateDistributionCrossValidationEstimator;
+    typedef CachedEstimator< ContinuousMultivariateDistribution, ContinuousMultivariateDistributionEstimation > ContinuousMultivariateDistributionCachedEstimator;
 
     struct STATISKIT_CORE_API UnivariateConditionalDistributionEstimation
     {
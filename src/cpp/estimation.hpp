@@ -3,6 +3,10 @@
 
 namespace statiskit
 {
+    template<class E>
+        SufficientStatistic< E >::~SufficientStatistic()
+        {}
+
     template<class D, class B>
         LazyEstimation< D, B >::LazyEstimation()
         { _estimated = nullptr; }
@@ -157,11 +161,16 @@ namespace statiskit
     template<class D, class B>
         void Selection< D, B >::finalize()
         {
-            std::vector< double >::const_iterator it = std::max_element(_scores.cbegin(), _scores.cend());
-            if(it != _scores.cend() && boost::math::isfinite(*it))
-            { this->_estimated = static_cast< const D * >(_estimations[distance(_scores.cbegin(), it)]->get_estimated()); }
-            else
-            { this->_estimated = nullptr; }
+            this->_estimated = nullptr;
+            double prev = -1 * std::numeric_limits< double >::infinity();
+            for(Index index = 0, max_index = size(); index < max_index; ++index)
+            {
+                if(_scores[index] > prev && boost::math::isfinite(_scores[index]))
+                {
+                    prev = _scores[index];
+                    this->_estimated = static_cast< const D * >(_estimations[index]->get_estimated());
+                }
+            }
         }
 
     template<class D, class B>
@@ -178,25 +187,31 @@ namespace statiskit
     template<class D, class B>
         std::unique_ptr< typename B::Estimator::estimation_type > Selection< D, B >::Estimator::operator() (const typename B::data_type& data, const bool& lazy) const
         {
+            std::vector< std::unique_ptr< typename B::Estimator::estimation_type > > estimations(size());
+            std::vector< typename B::estimated_type const * > estimated(size(), nullptr);
+            __impl::parallel_for(size(), [this, &data, &lazy, &estimations, &estimated](const Index& index)
+            {
+                try
+                {
+                    estimations[index] = (*(_estimators[index]))(data, lazy);
+                    if(estimations[index])
+                    { estimated[index] = estimations[index]->get_estimated(); }
+                }
+                catch(const std::exception& e)
+                { estimations[index].reset(); }
+            });
+            std::vector< double > scores = scoring(estimated, data);
             std::unique_ptr< typename B::Estimator::estimation_type > estimation = std::make_unique< LazyEstimation< D, B > >();
             if(lazy)
             {
-                std::unique_ptr< typename B::Estimator::estimation_type > _estimation;
-                double curr, prev = -1 * std::numeric_limits< double >::infinity();
+                double prev = -1 * std::numeric_limits< double >::infinity();
                 for(Index index = 0, max_index = size(); index < max_index; ++index)
                 { 
-                    try
+                    if(scores[index] > prev && boost::math::isfinite(scores[index]))
                     {
-                        _estimation = (*(_estimators[index]))(data, true);
-                        curr = scoring(_estimation->get_estimated(), data);
-                        if(curr > prev && boost::math::isfinite(curr))
-                        {
-                            prev = curr;
-                            estimation.swap(_estimation);
-                        }
+                        prev = scores[index];
+                        estimation.swap(estimations[index]);
                     }
-                    catch(const std::exception& e)
-                    {}
                 }
             }
             else
@@ -204,25 +219,34 @@ namespace statiskit
                 Selection< D, B >* _estimation = new Selection< D, B >(data.copy().release());
                 for(Index index = 0, max_index = size(); index < max_index; ++index)
                 { 
-                    try
-                    {
-                        _estimation->_estimations.push_back(static_cast< B* >((*(_estimators[index]))(data, false).release()));
-                        _estimation->_scores.push_back(scoring(_estimation->_estimations.back()->get_estimated(), data));
-                    }
-                    catch(const std::exception& e)
-                    {
-                        _estimation->_estimations.push_back(nullptr);
-                        _estimation->_scores.push_back(std::numeric_limits< double >::quiet_NaN());
-                    }
+                    _estimation->_estimations.push_back(static_cast< B* >(estimations[index].release()));
+                    _estimation->_scores.push_back(scores[index]);
                 }
                 _estimation->finalize();
                 estimation.reset(_estimation);
             }
             if(!estimation->get_estimated())
-            { std::runtime_error("All estimations failed, perform manually the estimation in order to investigate what went wrong"); }
+            { throw std::runtime_error("All estimations failed, perform manually the estimation in order to investigate what went wrong"); }
             return estimation;
         }
 
+    template<class D, class B>
+        std::vector< double > Selection< D, B >::Estimator::scoring(const std::vector< typename B::estimated_type const * >& estimated, typename B::data_type const & data) const
+        {
+            std::vector< double > scores(estimated.size(), std::numeric_limits< double >::quiet_NaN());
+            __impl::parallel_for(estimated.size(), [this, &estimated, &data, &scores](const Index& index)
+            {
+                if(estimated[index])
+                {
+                    try
+                    { scores[index] = scoring(estimated[index], data); }
+                    catch(const std::exception& e)
+                    {}
+                }
+            });
+            return scores;
+        }
+
     template<class D, class B>
         Index Selection< D, B >::Estimator::size() const
         { return _estimators.size(); }
@@ -299,10 +323,78 @@ namespace statiskit
 
     template<class D, class B>
         double Selection< D, B >::CriterionEstimator::scoring(const typename B::estimated_type * estimated, typename B::data_type const & data) const
+        { return penalize(estimated->loglikelihood(data), estimated->get_nb_parameters(), data.compute_total()); }
+
+    template<class D, class B>
+        std::vector< double > Selection< D, B >::CriterionEstimator::scoring(const std::vector< typename B::estimated_type const * >& estimated, typename B::data_type const & data) const
+        {
+            std::vector< double > scores(estimated.size(), 0.);
+            if(!std::is_base_of< UnivariateDistribution, typename B::estimated_type >::value)
+            {
+                // Multivariate distributions can override the loglikelihood with a batched computation
+                double total = data.compute_total();
+                __impl::parallel_for(estimated.size(), [this, &estimated, &data, &scores, &total](const Index& index)
+                {
+                    if(estimated[index])
+                    {
+                        try
+                        { scores[index] = penalize(estimated[index]->loglikelihood(data), estimated[index]->get_nb_parameters(), total); }
+                        catch(const std::exception& e)
+                        { scores[index] = std::numeric_limits< double >::quiet_NaN(); }
+                    }
+                    else
+                    { scores[index] = std::numeric_limits< double >::quiet_NaN(); }
+                });
+                return scores;
+            }
+            std::vector< char > valid(estimated.size(), false);
+            for(Index index = 0, max_index = estimated.size(); index < max_index; ++index)
+            { valid[index] = estimated[index] != nullptr; }
+            double total = 0.;
+            Index nb_groups = std::min< Index >(get_nb_threads(), estimated.size());
+            __impl::parallel_for(nb_groups, [&estimated, &data, &scores, &valid, &total, nb_groups](const Index& group)
+            {
+                // Each group of candidates shares a single pass over the data
+                std::unique_ptr< typename B::data_type::Generator > generator = data.generator();
+                while(generator->is_valid())
+                {
+                    double weight = generator->weight();
+                    if(group == 0)
+                    { total += weight; }
+                    for(Index index = group, max_index = estimated.size(); index < max_index; index += nb_groups)
+                    {
+                        if(valid[index])
+                        {
+                            try
+                            {
+                                scores[index] += weight * estimated[index]->probability(generator->event(), true);
+                                if(!boost::math::isfinite(scores[index]))
+                                { valid[index] = false; }
+                            }
+                            catch(const std::exception& e)
+                            {
+                                scores[index] = std::numeric_limits< double >::quiet_NaN();
+                                valid[index] = false;
+                            }
+                        }
+                    }
+                    ++(*generator);
+                }
+            });
+            for(Index index = 0, max_index = estimated.size(); index < max_index; ++index)
+            {
+                if(estimated[index])
+                { scores[index] = penalize(scores[index], estimated[index]->get_nb_parameters(), total); }
+                else
+                { scores[index] = std::numeric_limits< double >::quiet_NaN(); }
+            }
+            return scores;
+        }
+
+    template<class D, class B>
+        double Selection< D, B >::CriterionEstimator::penalize(const double& loglikelihood, const unsigned int& nb_parameters, const double& total) const
         {
-            double score = estimated->loglikelihood(data);
-            double total = data.compute_total();
-            unsigned int nb_parameters = estimated->get_nb_parameters();
+            double score = loglikelihood;
             switch(_criterion)
             {
                 case AIC:
@@ -321,6 +413,352 @@ namespace statiskit
             return score;
         }
 
+    template<class D, class B>
+        Selection< D, B >::CrossValidationEstimator::CrossValidationEstimator()
+        {
+            this->init();
+            _nb_folds = 5;
+            _early_stopping = 0;
+        }
+
+    template<class D, class B>
+        Selection< D, B >::CrossValidationEstimator::CrossValidationEstimator(const CrossValidationEstimator& estimator)
+        {
+            this->init(estimator);
+            _nb_folds = estimator._nb_folds;
+            _early_stopping = estimator._early_stopping;
+        }
+
+    template<class D, class B>
+        Selection< D, B >::CrossValidationEstimator::~CrossValidationEstimator()
+        {}
+
+    template<class D, class B>
+        const Index& Selection< D, B >::CrossValidationEstimator::get_nb_folds() const
+        { return _nb_folds; }
+
+    template<class D, class B>
+        void Selection< D, B >::CrossValidationEstimator::set_nb_folds(const Index& nb_folds)
+        {
+            if(nb_folds < 2)
+            { throw lower_bound_error("nb_folds", nb_folds, 2, false); }
+            _nb_folds = nb_folds;
+        }
+
+    template<class D, class B>
+        const Index& Selection< D, B >::CrossValidationEstimator::get_early_stopping() const
+        { return _early_stopping; }
+
+    template<class D, class B>
+        void Selection< D, B >::CrossValidationEstimator::set_early_stopping(const Index& early_stopping)
+        { _early_stopping = early_stopping; }
+
+    template<class D, class B>
+        double Selection< D, B >::CrossValidationEstimator::scoring(const typename B::estimated_type * estimated, typename B::data_type const & data) const
+        { return scoring(std::vector< typename B::estimated_type const * >(1, estimated), data).front(); }
+
+    template<class D, class B>
+        std::vector< double > Selection< D, B >::CrossValidationEstimator::scoring(const std::vector< typename B::estimated_type const * >& estimated, typename B::data_type const & data) const
+        {
+            std::vector< double > weights;
+            std::unique_ptr< typename B::data_type::Generator > generator = data.generator();
+            while(generator->is_valid())
+            {
+                weights.push_back(generator->weight());
+                ++(*generator);
+            }
+            std::vector< Index > folds(weights.size());
+            for(Index index = 0, max_index = folds.size(); index < max_index; ++index)
+            { folds[index] = index % _nb_folds; }
+            for(Index index = folds.size(); index > 1; --index)
+            {
+                boost::uniform_int< Index > dist(0, index - 1);
+                boost::variate_generator< boost::mt19937&, boost::uniform_int< Index > > simulator(__impl::get_random_generator(), dist);
+                std::swap(folds[index - 1], folds[simulator()]);
+            }
+            // Training sets are views of the data in which held-out events get a null weight
+            std::vector< std::unique_ptr< Fold > > trainings(_nb_folds);
+            for(Index fold = 0; fold < _nb_folds; ++fold)
+            { trainings[fold] = std::make_unique< Fold >(&data, &folds, &weights, fold); }
+            std::vector< std::vector< double > > heldouts(estimated.size(), std::vector< double >(_nb_folds, 0.));
+            std::vector< bool > actives(estimated.size(), false);
+            for(Index index = 0, max_index = estimated.size(); index < max_index; ++index)
+            { actives[index] = estimated[index]; }
+            Index first = 0;
+            while(first < _nb_folds)
+            {
+                Index last = _nb_folds;
+                if(first == 0 && _early_stopping > 0 && _early_stopping < _nb_folds)
+                { last = _early_stopping; }
+                std::vector< Index > candidates;
+                for(Index index = 0, max_index = estimated.size(); index < max_index; ++index)
+                {
+                    if(actives[index])
+                    { candidates.push_back(index); }
+                }
+                Index nb_stage_folds = last - first;
+                std::vector< std::unique_ptr< typename B::Estimator::estimation_type > > estimations(candidates.size() * nb_stage_folds);
+                __impl::parallel_for(estimations.size(), [this, &candidates, &trainings, &estimations, first, nb_stage_folds](const Index& index)
+                {
+                    try
+                    { estimations[index] = (*(this->_estimators[candidates[index / nb_stage_folds]]))(*(trainings[first + index % nb_stage_folds]), true); }
+                    catch(const std::exception& e)
+                    { estimations[index].reset(); }
+                });
+                __impl::parallel_for(candidates.size(), [&data, &folds, &candidates, &estimations, &heldouts, first, last, nb_stage_folds](const Index& index)
+                {
+                    std::vector< double >& heldout = heldouts[candidates[index]];
+                    for(Index fold = first; fold < last; ++fold)
+                    {
+                        const std::unique_ptr< typename B::Estimator::estimation_type >& estimation = estimations[index * nb_stage_folds + fold - first];
+                        if(!estimation || !estimation->get_estimated())
+                        { heldout[fold] = std::numeric_limits< double >::quiet_NaN(); }
+                    }
+                    std::unique_ptr< typename B::data_type::Generator > generator = data.generator();
+                    Index event = 0;
+                    while(generator->is_valid())
+                    {
+                        Index fold = folds[event];
+                        if(fold >= first && fold < last && boost::math::isfinite(heldout[fold]))
+                        {
+                            try
+                            { heldout[fold] += generator->weight() * estimations[index * nb_stage_folds + fold - first]->get_estimated()->probability(generator->event(), true); }
+                            catch(const std::exception& e)
+                            { heldout[fold] = std::numeric_limits< double >::quiet_NaN(); }
+                        }
+                        ++event;
+                        ++(*generator);
+                    }
+                });
+                for(Index index = 0, max_index = candidates.size(); index < max_index; ++index)
+                {
+                    for(Index fold = first; fold < last; ++fold)
+                    {
+                        if(!boost::math::isfinite(heldouts[candidates[index]][fold]))
+                        { actives[candidates[index]] = false; }
+                    }
+                }
+                if(last < _nb_folds)
+                {
+                    // Discard candidates beaten by the leader on every fold already computed
+                    Index leader = estimated.size();
+                    double best = -1 * std::numeric_limits< double >::infinity();
+                    for(Index index = 0, max_index = estimated.size(); index < max_index; ++index)
+                    {
+                        if(actives[index])
+                        {
+                            double score = std::accumulate(heldouts[index].cbegin(), heldouts[index].cbegin() + last, 0.);
+                            if(score > best)
+                            {
+                                best = score;
+                                leader = index;
+                            }
+                        }
+                    }
+                    for(Index index = 0, max_index = estimated.size(); index < max_index; ++index)
+                    {
+                        if(actives[index] && index != leader)
+                        {
+                            bool dominated = true;
+                            for(Index fold = 0; fold < last && dominated; ++fold)
+                            { dominated = heldouts[index][fold] < heldouts[leader][fold]; }
+                            if(dominated)
+                            { actives[index] = false; }
+                        }
+                    }
+                }
+                first = last;
+            }
+            std::vector< double > scores(estimated.size(), std::numeric_limits< double >::quiet_NaN());
+            for(Index index = 0, max_index = estimated.size(); index < max_index; ++index)
+            {
+                if(actives[index])
+                { scores[index] = std::accumulate(heldouts[index].cbegin(), heldouts[index].cend(), 0.) / _nb_folds; }
+            }
+            return scores;
+        }
+
+    template<class D, class B>
+        Selection< D, B >::CrossValidationEstimator::Fold::Fold(typename B::data_type const * data, const std::vector< Index >* folds, const std::vector< double >* weights, const Index& fold)
+        {
+            this->_data = data;
+            _folds = folds;
+            _shared = weights;
+            _fold = fold;
+        }
+
+    template<class D, class B>
+        Selection< D, B >::CrossValidationEstimator::Fold::Fold(const Fold& fold)
+        {
+            this->_data = fold._data;
+            _folds = fold._folds;
+            _shared = fold._shared;
+            _fold = fold._fold;
+        }
+
+    template<class D, class B>
+        Selection< D, B >::CrossValidationEstimator::Fold::~Fold()
+        {}
+
+    template<class D, class B>
+        Index Selection< D, B >::CrossValidationEstimator::Fold::get_nb_weights() const
+        { return _folds->size(); }
+
+    template<class D, class B>
+        double Selection< D, B >::CrossValidationEstimator::Fold::get_weight(const Index& index) const
+        {
+            if(index >= get_nb_weights())
+            { throw size_error("index", get_nb_weights(), size_error::inferior); }
+            return (*_folds)[index] == _fold ? 0. : (*_shared)[index];
+        }
+
+    template<class D, class B>
+        CachedEstimator< D, B >::CachedEstimator()
+        {
+            _estimator = nullptr;
+            _cache = std::make_shared< Cache >();
+            _cache->capacity = 64;
+        }
+
+    template<class D, class B>
+        CachedEstimator< D, B >::CachedEstimator(const typename B::Estimator& estimator)
+        {
+            _estimator = static_cast< typename B::Estimator* >(estimator.copy().release());
+            _cache = std::make_shared< Cache >();
+            _cache->capacity = 64;
+        }
+
+    template<class D, class B>
+        CachedEstimator< D, B >::CachedEstimator(const CachedEstimator< D, B >& estimator)
+        {
+            if(estimator._estimator)
+            { _estimator = static_cast< typename B::Estimator* >(estimator._estimator->copy().release()); }
+            else
+            { _estimator = nullptr; }
+            _cache = estimator._cache;
+        }
+
+    template<class D, class B>
+        CachedEstimator< D, B >::~CachedEstimator()
+        {
+            if(_estimator)
+            { delete _estimator; }
+        }
+
+    template<class D, class B>
+        std::unique_ptr< typename B::Estimator::estimation_type > CachedEstimator< D, B >::operator() (const typename B::data_type& data, const bool& lazy) const
+        {
+            if(!_estimator)
+            { throw member_error("estimator", "you must give an estimator in order to use a cached estimator"); }
+            std::size_t fingerprint = data.compute_fingerprint();
+            if(lazy)
+            {
+                std::lock_guard< std::mutex > lock(_cache->mutex);
+                typename std::unordered_map< std::size_t, typename Cache::entries_type::iterator >::iterator it = _cache->positions.find(fingerprint);
+                if(it != _cache->positions.end())
+                {
+                    _cache->entries.splice(_cache->entries.begin(), _cache->entries, it->second);
+                    return std::make_unique< LazyEstimation< D, B > >(static_cast< D* >(it->second->second->copy().release()));
+                }
+            }
+            std::unique_ptr< typename B::Estimator::estimation_type > estimation = (*_estimator)(data, lazy);
+            if(estimation && estimation->get_estimated())
+            {
+                std::lock_guard< std::mutex > lock(_cache->mutex);
+                _cache->insert(fingerprint, estimation->get_estimated());
+            }
+            return estimation;
+        }
+
+    template<class D, class B>
+        std::unique_ptr< typename B::Estimator::estimation_type > CachedEstimator< D, B >::operator() (const typename B::Estimator::statistic_type& statistic) const
+        {
+            if(!_estimator)
+            { throw member_error("estimator", "you must give an estimator in order to use a cached estimator"); }
+            return static_cast< const typename B::Estimator::estimation_type::Estimator& >(*_estimator)(statistic);
+        }
+
+    template<class D, class B>
+        std::unique_ptr< typename B::Estimator::statistic_type > CachedEstimator< D, B >::statistic() const
+        {
+            std::unique_ptr< typename B::Estimator::statistic_type > statistic;
+            if(_estimator)
+            { statistic = _estimator->statistic(); }
+            return statistic;
+        }
+
+    template<class D, class B>
+        std::unique_ptr< typename B::Estimator > CachedEstimator< D, B >::get_estimator() const
+        {
+            std::unique_ptr< typename B::Estimator > estimator;
+            if(_estimator)
+            { estimator.reset(static_cast< typename B::Estimator* >(_estimator->copy().release())); }
+            return estimator;
+        }
+
+    template<class D, class B>
+        void CachedEstimator< D, B >::set_estimator(const typename B::Estimator& estimator)
+        {
+            if(_estimator)
+            { delete _estimator; }
+            _estimator = static_cast< typename B::Estimator* >(estimator.copy().release());
+            Index capacity = get_capacity();
+            _cache = std::make_shared< Cache >();
+            _cache->capacity = capacity;
+        }
+
+    template<class D, class B>
+        Index CachedEstimator< D, B >::get_capacity() const
+        {
+            std::lock_guard< std::mutex > lock(_cache->mutex);
+            return _cache->capacity;
+        }
+
+    template<class D, class B>
+        void CachedEstimator< D, B >::set_capacity(const Index& capacity)
+        {
+            std::lock_guard< std::mutex > lock(_cache->mutex);
+            _cache->capacity = capacity;
+            while(_cache->entries.size() > capacity)
+            {
+                _cache->positions.erase(_cache->entries.back().first);
+                _cache->entries.pop_back();
+            }
+        }
+
+    template<class D, class B>
+        Index CachedEstimator< D, B >::size() const
+        {
+            std::lock_guard< std::mutex > lock(_cache->mutex);
+            return _cache->entries.size();
+        }
+
+    template<class D, class B>
+        void CachedEstimator< D, B >::clear()
+        {
+            std::lock_guard< std::mutex > lock(_cache->mutex);
+            _cache->positions.clear();
+            _cache->entries.clear();
+        }
+
+    template<class D, class B>
+        void CachedEstimator< D, B >::Cache::insert(const std::size_t& fingerprint, const typename B::estimated_type * estimated)
+        {
+            typename std::unordered_map< std::size_t, typename entries_type::iterator >::iterator it = positions.find(fingerprint);
+            if(it != positions.end())
+            { entries.splice(entries.begin(), entries, it->second); }
+            else if(capacity > 0)
+            {
+                entries.emplace_front(fingerprint, estimated->copy());
+                positions[fingerprint] = entries.begin();
+                while(entries.size() > capacity)
+                {
+                    positions.erase(entries.back().first);
+                    entries.pop_back();
+                }
+            }
+        }
+
     template<class T, class D, class B>
         OptimizationEstimationImpl< T, D, B >::OptimizationEstimationImpl() : ActiveEstimation< D, B >()
         { _iterations.clear(); }
@@ -10,6 +10,126 @@
 
 namespace statiskit
 {
+    namespace __impl
+    {
+        void frequencies(const UnivariateData& data, std::vector< int >& values, std::vector< double >& weights, double& square)
+        {
+            std::map< int, double > table;
+            square = 0.;
+            std::unique_ptr< UnivariateData::Generator > generator = data.generator();
+            while(generator->is_valid())
+            {
+                const UnivariateEvent* event = generator->event();
+                if(event && event->get_event() == ELEMENTARY && generator->weight() > 0.)
+                {
+                    table[static_cast< const DiscreteElementaryEvent* >(event)->get_value()] += generator->weight();
+                    square += pow(generator->weight(), 2);
+                }
+                ++(*generator);
+            }
+            values.clear();
+            weights.clear();
+            values.reserve(table.size());
+            weights.reserve(table.size());
+            for(std::map< int, double >::const_iterator it = table.cbegin(), it_end = table.cend(); it != it_end; ++it)
+            {
+                values.push_back(it->first);
+                weights.push_back(it->second);
+            }
+        }
+
+        void frequencies(const UnivariateData& data, std::vector< int >& values, std::vector< double >& weights)
+        {
+            double square;
+            frequencies(data, values, weights, square);
+        }
+
+        void observations(const UnivariateData& data, Eigen::ArrayXd& values, Eigen::ArrayXd& weights)
+        {
+            std::vector< std::pair< double, double > > table;
+            std::unique_ptr< UnivariateData::Generator > generator = data.generator();
+            while(generator->is_valid())
+            {
+                const UnivariateEvent* event = generator->event();
+                if(event && event->get_event() == ELEMENTARY && generator->weight() > 0.)
+                { table.push_back(std::make_pair(static_cast< const ContinuousElementaryEvent* >(event)->get_value(), generator->weight())); }
+                ++(*generator);
+            }
+            std::sort(table.begin(), table.end());
+            values.resize(table.size());
+            weights.resize(table.size());
+            for(Index index = 0, max_index = table.size(); index < max_index; ++index)
+            {
+                values[index] = table[index].first;
+                weights[index] = table[index].second;
+            }
+        }
+
+        NaturalQuantileEstimation quantiles(const Eigen::ArrayXd& values, const Eigen::ArrayXd& weights)
+        {
+            // values are the sorted observations of __impl::observations
+            std::vector< double > _values(values.size()), cumulative(values.size());
+            double total = 0.;
+            for(Index index = 0, max_index = values.size(); index < max_index; ++index)
+            {
+                total += weights[index];
+                _values[index] = values[index];
+                cumulative[index] = total;
+            }
+            return NaturalQuantileEstimation(_values, cumulative);
+        }
+
+        template<class G> void location_scale(const Eigen::ArrayXd& values, const Eigen::ArrayXd& weights, double& mu, double& sigma, G g, const std::function< bool(const unsigned int&, const double&) >& run, const std::function< void(const double&, const double&) >& iteration)
+        {
+            // g computes the standardized log-density and its first two derivatives, the log-density being g(z) - log(sigma)
+            double total = weights.sum();
+            Eigen::ArrayXd z, g0, g1, g2;
+            auto loglikelihood = [&](const double& _mu, const double& _sigma) -> double
+            {
+                z = (values - _mu) / _sigma;
+                g(z, g0, g1, g2);
+                return (weights * g0).sum() - total * log(_sigma);
+            };
+            double llh = loglikelihood(mu, sigma), delta;
+            unsigned int its = 0;
+            do
+            {
+                Eigen::Vector2d gradient, step;
+                Eigen::Matrix2d hessian;
+                gradient << - (weights * g1).sum() / sigma, - (weights * (1. + z * g1)).sum();
+                hessian(0, 0) = (weights * g2).sum() / pow(sigma, 2);
+                hessian(0, 1) = hessian(1, 0) = (weights * (g1 + z * g2)).sum() / sigma;
+                hessian(1, 1) = (weights * z * (g1 + z * g2)).sum();
+                if(hessian(0, 0) < 0. && hessian.determinant() > 0.)
+                { step = - hessian.inverse() * gradient; }
+                else
+                { step << pow(sigma, 2) * gradient[0] / total, gradient[1] / total; }
+                double next, _mu, _sigma, factor = 1.;
+                do
+                {
+                    _mu = mu + factor * step[0];
+                    _sigma = sigma * exp(factor * step[1]);
+                    next = loglikelihood(_mu, _sigma);
+                    factor /= 2.;
+                } while(!(next >= llh) && factor > 1e-10);
+                if(next >= llh)
+                {
+                    delta = std::max(fabs(_mu - mu) / _sigma, fabs(log(_sigma / sigma)));
+                    mu = _mu;
+                    sigma = _sigma;
+                    llh = next;
+                }
+                else
+                {
+                    delta = 0.;
+                    loglikelihood(mu, sigma);
+                }
+                iteration(mu, sigma);
+                ++its;
+            } while(run(its, delta));
+        }
+    }
+
     PoissonDistributionMLEstimation::PoissonDistributionMLEstimation() : ActiveEstimation< PoissonDistribution, DiscreteUnivariateDistributionEstimation >()
     {}
 
@@ -36,11 +156,13 @@ namespace statiskit
         if(data.get_sample_space()->get_outcome() != DISCRETE)
         { throw statiskit::sample_space_error(DISCRETE); }
         std::unique_ptr< UnivariateDistributionEstimation > estimation; 
-        NaturalMeanEstimation::Estimator estimator = NaturalMeanEstimation::Estimator();
-        std::unique_ptr< MeanEstimation > _estimation = estimator(data);
-        double mean = _estimation->get_mean(); 
-        if(boost::math::isfinite(mean))
+        UnivariateMomentStatistic moments = UnivariateMomentStatistic();
+        moments.update(data);
+        if(moments.get_total() <= 0.)
+        { throw sample_size_error(1); }
+        if(boost::math::isfinite(moments.get_mean()))
         {
+            double mean = moments.get_mean();
             PoissonDistribution* poisson = new PoissonDistribution(mean);
             if(lazy)
             { estimation = std::make_unique< LazyEstimation< PoissonDistribution, DiscreteUnivariateDistributionEstimation > >(poisson); }
@@ -53,6 +175,25 @@ namespace statiskit
     std::unique_ptr< UnivariateDistributionEstimation::Estimator > PoissonDistributionMLEstimation::Estimator::copy() const
     { return std::make_unique< Estimator >(*this); }
 
+    std::unique_ptr< UnivariateDistributionEstimation > PoissonDistributionMLEstimation::Estimator::operator() (const statistic_type& statistic) const
+    {
+        std::unique_ptr< UnivariateDistributionEstimation > estimation;
+        const UnivariateMomentStatistic* moments = dynamic_cast< const UnivariateMomentStatistic* >(&statistic);
+        if(moments)
+        {
+            if(moments->get_total() <= 0.)
+            { throw sample_size_error(1); }
+            if(boost::math::isfinite(moments->get_mean()))
+            { estimation = std::make_unique< LazyEstimation< PoissonDistribution, DiscreteUnivariateDistributionEstimation > >(new PoissonDistribution(moments->get_mean())); }
+        }
+        else
+        { estimation = DiscreteUnivariateDistributionEstimation::Estimator::operator() (statistic); }
+        return estimation;
+    }
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator::statistic_type > PoissonDistributionMLEstimation::Estimator::statistic() const
+    { return std::make_unique< UnivariateMomentStatistic >(); }
+
     BinomialDistributionMLEstimation::BinomialDistributionMLEstimation() : OptimizationEstimation<unsigned int, BinomialDistribution, DiscreteUnivariateDistributionEstimation >()
     {}
 
@@ -79,81 +220,127 @@ namespace statiskit
         if(data.get_sample_space()->get_outcome() != DISCRETE)
         { throw statiskit::sample_space_error(DISCRETE); }
         std::unique_ptr< UnivariateDistributionEstimation > estimation;
-        NaturalMeanEstimation::Estimator mean_estimator = NaturalMeanEstimation::Estimator();
-        std::unique_ptr< MeanEstimation > mean_estimation = mean_estimator(data);
-        double mean = mean_estimation->get_mean();
-        NaturalVarianceEstimation::Estimator variance_estimator = NaturalVarianceEstimation::Estimator(false);
-        std::unique_ptr< VarianceEstimation > variance_estimation = variance_estimator(data, mean);
-        double variance = variance_estimation->get_variance(); 
+        std::vector< int > values;
+        std::vector< double > weights;
+        __impl::frequencies(data, values, weights);
+        if(values.size() == 0)
+        { throw sample_size_error(1); }
+        double total = 0., sum = 0., constant = 0.;
+        for(Index index = 0, max_index = values.size(); index < max_index; ++index)
+        {
+            total += weights[index];
+            sum += weights[index] * values[index];
+            constant -= weights[index] * boost::math::lgamma(values[index] + 1.);
+        }
+        double mean = sum / total, variance = 0.;
+        for(Index index = 0, max_index = values.size(); index < max_index; ++index)
+        { variance += weights[index] * pow(values[index] - mean, 2); }
+        variance /= total;
         if(variance > mean && !_force)
         { throw overdispersion_error(); }
-        unsigned int kappa = std::max<int>(round(pow(mean, 2)/(mean - variance)), static_cast< DiscreteElementaryEvent* >(data.compute_maximum().get())->get_value());
-        BinomialDistribution* binomial = new BinomialDistribution(kappa, mean/double(kappa));
-        if(!lazy)
+        unsigned int minimum = std::max(values.back(), 1);
+        std::vector< unsigned int > iterations;
+        // Successive profile evaluations share most of their log-factorials, they are stored once computed
+        std::unordered_map< unsigned int, double > lfactorials;
+        auto lfactorial = [&lfactorials](const unsigned int& value) -> double
         {
-            estimation = std::make_unique< BinomialDistributionMLEstimation >(binomial, &data);
-            static_cast< BinomialDistributionMLEstimation* >(estimation.get())->_iterations.push_back(kappa);
-        }
-        else
-        { estimation = std::make_unique< LazyEstimation< BinomialDistribution, DiscreteUnivariateDistributionEstimation > >(binomial); }
-        double curr, prev = binomial->loglikelihood(data);
-        unsigned int its = 1;
-        --kappa;
-        if(kappa > mean)
+            std::unordered_map< unsigned int, double >::iterator it = lfactorials.find(value);
+            if(it == lfactorials.end())
+            { it = lfactorials.emplace(value, boost::math::lgamma(value + 1.)).first; }
+            return it->second;
+        };
+        auto profile = [&values, &weights, &iterations, &lfactorial, total, sum, constant, minimum](const unsigned int& kappa) -> double
         {
-            if(!lazy)
-            { static_cast< BinomialDistributionMLEstimation* >(estimation.get())->_iterations.push_back(kappa); }
-            binomial->set_kappa(kappa);
-            binomial->set_pi(mean/double(kappa));
-            curr = binomial->loglikelihood(data);
-        }
-        else
-        { curr = prev; }
-        if(curr > prev)
+            iterations.push_back(kappa);
+            double llh = constant + total * lfactorial(kappa), pi = sum / (total * kappa);
+            for(Index index = 0, max_index = values.size(); index < max_index; ++index)
+            { llh -= weights[index] * lfactorial(kappa - values[index]); }
+            if(sum > 0.)
+            { llh += sum * log(pi); }
+            if(total * kappa > sum)
+            { llh += (total * kappa - sum) * log(1. - pi); }
+            return llh;
+        };
+        unsigned int kappa = minimum;
+        if(mean > variance)
+        { kappa = std::max< double >(round(pow(mean, 2)/(mean - variance)), minimum); }
+        unsigned int lower, upper;
+        double curr = profile(kappa), prev = profile(kappa + 1), next;
+        unsigned int its = 2;
+        if(prev > curr)
         {
+            lower = kappa;
+            kappa = kappa + 1;
+            unsigned int step = 2;
             do
             {
-                prev = curr;
-                --kappa;
-                if(!lazy)
-                { static_cast< BinomialDistributionMLEstimation* >(estimation.get())->_iterations.push_back(kappa); }
-                binomial->set_kappa(kappa);
-                binomial->set_pi(mean/double(kappa));
-                curr = binomial->loglikelihood(data);
+                upper = kappa + step;
+                next = profile(upper);
                 ++its;
-            } while(run(its, __impl::reldiff(prev, curr)) && curr > prev);
-            if(curr < prev)
-            {
-                ++kappa;
-                if(!lazy)
-                { static_cast< BinomialDistributionMLEstimation* >(estimation.get())->_iterations.push_back(kappa); }
-                binomial->set_kappa(kappa);
-                binomial->set_pi(mean/double(kappa));
-            }
+                if(next > prev)
+                {
+                    lower = kappa;
+                    kappa = upper;
+                    std::swap(prev, next);
+                    step *= 2;
+                }
+                else
+                { break; }
+            } while(run(its, __impl::reldiff(next, prev)));
+            curr = prev;
         }
         else
         {
-            ++kappa;
-            do
+            upper = kappa + 1;
+            lower = kappa;
+            unsigned int step = 1;
+            while(kappa > minimum)
             {
-                prev = curr;
-                ++kappa;
-                if(!lazy)
-                { static_cast< BinomialDistributionMLEstimation* >(estimation.get())->_iterations.push_back(kappa); }
-                binomial->set_kappa(kappa);
-                binomial->set_pi(mean/double(kappa));
-                curr = binomial->loglikelihood(data);
+                lower = kappa - std::min(step, kappa - minimum);
+                next = profile(lower);
                 ++its;
-            } while(run(its, __impl::reldiff(prev, curr)) && curr > prev);
-            if(curr < prev)
-            {
-                --kappa;
-                if(!lazy)
-                { static_cast< BinomialDistributionMLEstimation* >(estimation.get())->_iterations.push_back(kappa); }
-                binomial->set_kappa(kappa);
-                binomial->set_pi(mean/double(kappa));
+                if(next > curr)
+                {
+                    upper = kappa;
+                    kappa = lower;
+                    curr = next;
+                    step *= 2;
+                }
+                else
+                { break; }
             }
         }
+        while(upper - lower > 2)
+        {
+            unsigned int candidate;
+            if(kappa - lower > upper - kappa)
+            { candidate = kappa - (kappa - lower) / 2; }
+            else
+            { candidate = kappa + (upper - kappa) / 2; }
+            next = profile(candidate);
+            if(next > curr)
+            {
+                if(candidate < kappa)
+                { upper = kappa; }
+                else
+                { lower = kappa; }
+                kappa = candidate;
+                curr = next;
+            }
+            else if(candidate < kappa)
+            { lower = candidate; }
+            else
+            { upper = candidate; }
+        }
+        iterations.push_back(kappa);
+        BinomialDistribution* binomial = new BinomialDistribution(kappa, mean / double(kappa));
+        if(!lazy)
+        {
+            estimation = std::make_unique< BinomialDistributionMLEstimation >(binomial, &data);
+            static_cast< BinomialDistributionMLEstimation* >(estimation.get())->_iterations = iterations;
+        }
+        else
+        { estimation = std::make_unique< LazyEstimation< BinomialDistribution, DiscreteUnivariateDistributionEstimation > >(binomial); }
         return estimation;
     }
 
@@ -201,13 +388,32 @@ namespace statiskit
         if(data.get_sample_space()->get_outcome() != DISCRETE)
         { throw statiskit::sample_space_error(DISCRETE); }
         std::unique_ptr< UnivariateDistributionEstimation > estimation; 
-        std::unique_ptr< MeanEstimation > mean_estimation = (*_mean)(data);
-        double mean = mean_estimation->get_mean(); 
-        std::unique_ptr< VarianceEstimation > variance_estimation = (*_variance)(data, mean);
-        double variance = variance_estimation->get_variance(); 
+        double mean, variance, maximum;
+        const NaturalVarianceEstimation::Estimator* variance_estimator = dynamic_cast< const NaturalVarianceEstimation::Estimator* >(_variance);
+        if(variance_estimator && dynamic_cast< const NaturalMeanEstimation::Estimator* >(_mean))
+        {
+            UnivariateMomentStatistic moments = UnivariateMomentStatistic();
+            moments.update(data);
+            if(moments.get_total() > 0.)
+            {
+                mean = moments.get_mean();
+                variance = moments.get_variance(variance_estimator->get_bias());
+            }
+            else
+            { mean = variance = std::numeric_limits< double >::quiet_NaN(); }
+            maximum = moments.get_maximum();
+        }
+        else
+        {
+            std::unique_ptr< MeanEstimation > mean_estimation = (*_mean)(data);
+            mean = mean_estimation->get_mean(); 
+            std::unique_ptr< VarianceEstimation > variance_estimation = (*_variance)(data, mean);
+            variance = variance_estimation->get_variance(); 
+            maximum = static_cast< DiscreteElementaryEvent* >(data.compute_maximum().get())->get_value();
+        }
         if(boost::math::isfinite(mean) && boost::math::isfinite(variance) && mean > variance)
         {
-            unsigned int kappa = std::max<int>(round(pow(mean, 2)/(mean - variance)), static_cast< DiscreteElementaryEvent* >(data.compute_maximum().get())->get_value());
+            unsigned int kappa = std::max<int>(round(pow(mean, 2)/(mean - variance)), maximum);
             BinomialDistribution* binomial = new BinomialDistribution(kappa, mean/double(kappa));
             if(lazy)
             { estimation = std::make_unique< LazyEstimation< BinomialDistribution, DiscreteUnivariateDistributionEstimation > >(binomial); }
@@ -222,6 +428,37 @@ namespace statiskit
     std::unique_ptr< UnivariateDistributionEstimation::Estimator > BinomialDistributionMMEstimation::Estimator::copy() const
     { return std::make_unique< Estimator >(*this); }
 
+    std::unique_ptr< UnivariateDistributionEstimation > BinomialDistributionMMEstimation::Estimator::operator() (const statistic_type& statistic) const
+    {
+        std::unique_ptr< UnivariateDistributionEstimation > estimation;
+        const UnivariateMomentStatistic* moments = dynamic_cast< const UnivariateMomentStatistic* >(&statistic);
+        const NaturalVarianceEstimation::Estimator* variance_estimator = dynamic_cast< const NaturalVarianceEstimation::Estimator* >(_variance);
+        if(moments && variance_estimator && dynamic_cast< const NaturalMeanEstimation::Estimator* >(_mean))
+        {
+            if(moments->get_total() <= 0.)
+            { throw sample_size_error(1); }
+            double mean = moments->get_mean(), variance = moments->get_variance(variance_estimator->get_bias());
+            if(boost::math::isfinite(mean) && boost::math::isfinite(variance) && mean > variance)
+            {
+                unsigned int kappa = std::max<int>(round(pow(mean, 2)/(mean - variance)), moments->get_maximum());
+                estimation = std::make_unique< LazyEstimation< BinomialDistribution, DiscreteUnivariateDistributionEstimation > >(new BinomialDistribution(kappa, mean/double(kappa)));
+            }
+            else
+            { throw overdispersion_error(); }
+        }
+        else
+        { estimation = DiscreteUnivariateDistributionEstimation::Estimator::operator() (statistic); }
+        return estimation;
+    }
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator::statistic_type > BinomialDistributionMMEstimation::Estimator::statistic() const
+    {
+        std::unique_ptr< statistic_type > statistic;
+        if(dynamic_cast< const NaturalMeanEstimation::Estimator* >(_mean) && dynamic_cast< const NaturalVarianceEstimation::Estimator* >(_variance))
+        { statistic = std::make_unique< UnivariateMomentStatistic >(); }
+        return statistic;
+    }
+
     MeanEstimation::Estimator* BinomialDistributionMMEstimation::Estimator::get_mean()
     { return _mean; }
 
@@ -260,54 +497,80 @@ namespace statiskit
         if(data.get_sample_space()->get_outcome() != DISCRETE)
         { throw statiskit::sample_space_error(DISCRETE); }
         std::unique_ptr< UnivariateDistributionEstimation > estimation;
-        NaturalMeanEstimation::Estimator mean_estimator = NaturalMeanEstimation::Estimator();
-        std::unique_ptr< MeanEstimation > mean_estimation = mean_estimator(data);
-        double mean = mean_estimation->get_mean();
-        NaturalVarianceEstimation::Estimator variance_estimator = NaturalVarianceEstimation::Estimator(false);
-        std::unique_ptr< VarianceEstimation > variance_estimation = variance_estimator(data, mean);
-        double variance = variance_estimation->get_variance();
+        std::vector< int > values;
+        std::vector< double > weights;
+        double square;
+        __impl::frequencies(data, values, weights, square);
+        if(values.size() == 0)
+        { throw sample_size_error(1); }
+        double total = 0., sum = 0.;
+        for(Index index = 0, max_index = values.size(); index < max_index; ++index)
+        {
+            total += weights[index];
+            sum += weights[index] * values[index];
+        }
+        double mean = sum / total, variance = 0.;
+        for(Index index = 0, max_index = values.size(); index < max_index; ++index)
+        { variance += weights[index] * pow(values[index] - mean, 2); }
+        if(pow(total, 2) > square)
+        { variance *= total / (pow(total, 2) - square); }
+        else
+        { variance /= total; }
         if(variance < mean && !_force)
         { throw underdispersion_error(); }
-        double total = data.compute_total(), kappa;
+        double kappa;
         if(variance > mean)
         { kappa = pow(mean, 2)/(variance - mean); }
         else
         { kappa = 1.; }
-        NegativeBinomialDistribution* negative_binomial = new NegativeBinomialDistribution(kappa, mean / (mean + kappa));
-        if(!lazy)
-        {
-            estimation = std::make_unique< NegativeBinomialDistributionMLEstimation >(negative_binomial, &data);
-            static_cast< NegativeBinomialDistributionMLEstimation* >(estimation.get())->_iterations.push_back(kappa);
-        }
-        else
-        { estimation = std::make_unique< LazyEstimation< NegativeBinomialDistribution, DiscreteUnivariateDistributionEstimation > >(negative_binomial); }
-        double prev, curr = negative_binomial->loglikelihood(data);
+        std::vector< double > iterations(1, kappa);
+        double lower = -std::numeric_limits< double >::infinity(), upper = std::numeric_limits< double >::infinity(), prev, gradient;
         unsigned int its = 1;
         do
         {
-            prev = curr;
-            double alpha = 0;
-            std::unique_ptr< UnivariateData::Generator > generator = data.generator();
-            while(generator->is_valid())
+            prev = kappa;
+            double score = total * log(kappa / (kappa + mean)), hessian = total * mean / (kappa * (kappa + mean));
+            for(Index index = 0, max_index = values.size(); index < max_index; ++index)
             {
-                const UnivariateEvent* event = generator->event();
-                if(event && event->get_event() == ELEMENTARY)
+                if(values[index] > 0)
                 {
-                    for(int nu = 0, max_nu = static_cast< const DiscreteElementaryEvent* >(event)->get_value(); nu < max_nu; ++nu)
-                    { alpha += nu/(nu + kappa); }
+                    score += weights[index] * (boost::math::digamma(values[index] + kappa) - boost::math::digamma(kappa));
+                    hessian += weights[index] * (boost::math::trigamma(values[index] + kappa) - boost::math::trigamma(kappa));
                 }
-                ++(*generator);
             }
-            alpha /= -total;
-            alpha += mean;
-            kappa = log(1 + mean/kappa)/alpha;
-            if(!lazy)
-            { static_cast< NegativeBinomialDistributionMLEstimation* >(estimation.get())->_iterations.push_back(kappa); }
-            negative_binomial->set_kappa(kappa);
-            negative_binomial->set_pi(mean/(mean + kappa));
-            curr = negative_binomial->loglikelihood(data);
+            gradient = kappa * score;
+            double theta = log(kappa), curvature = gradient + pow(kappa, 2) * hessian, next;
+            if(score > 0.)
+            { lower = theta; }
+            else
+            { upper = theta; }
+            if(curvature < 0.)
+            { next = theta - gradient / curvature; }
+            else if(score > 0.)
+            { next = theta + 1.; }
+            else
+            { next = theta - 1.; }
+            if(!(next > lower && next < upper))
+            {
+                if(boost::math::isfinite(lower) && boost::math::isfinite(upper))
+                { next = (lower + upper) / 2.; }
+                else if(score > 0.)
+                { next = theta + 1.; }
+                else
+                { next = theta - 1.; }
+            }
+            kappa = exp(next);
+            iterations.push_back(kappa);
             ++its;
-        } while(run(its, __impl::reldiff(prev, curr)));
+        } while(run(its, std::min(__impl::reldiff(prev, kappa), fabs(gradient) / total)));
+        NegativeBinomialDistribution* negative_binomial = new NegativeBinomialDistribution(kappa, mean / (mean + kappa));
+        if(!lazy)
+        {
+            estimation = std::make_unique< NegativeBinomialDistributionMLEstimation >(negative_binomial, &data);
+            static_cast< NegativeBinomialDistributionMLEstimation* >(estimation.get())->_iterations = iterations;
+        }
+        else
+        { estimation = std::make_unique< LazyEstimation< NegativeBinomialDistribution, DiscreteUnivariateDistributionEstimation > >(negative_binomial); }
         return estimation;
     }
 
@@ -355,10 +618,27 @@ namespace statiskit
         if(data.get_sample_space()->get_outcome() != DISCRETE)
         { throw statiskit::sample_space_error(DISCRETE); }
         std::unique_ptr< UnivariateDistributionEstimation > estimation; 
-        std::unique_ptr< MeanEstimation > mean_estimation = (*_mean)(data);
-        double mean = mean_estimation->get_mean(); 
-        std::unique_ptr< VarianceEstimation > variance_estimation = (*_variance)(data, mean);
-        double variance = variance_estimation->get_variance(); 
+        double mean, variance;
+        const NaturalVarianceEstimation::Estimator* variance_estimator = dynamic_cast< const NaturalVarianceEstimation::Estimator* >(_variance);
+        if(variance_estimator && dynamic_cast< const NaturalMeanEstimation::Estimator* >(_mean))
+        {
+            UnivariateMomentStatistic moments = UnivariateMomentStatistic();
+            moments.update(data);
+            if(moments.get_total() > 0.)
+            {
+                mean = moments.get_mean();
+                variance = moments.get_variance(variance_estimator->get_bias());
+            }
+            else
+            { mean = variance = std::numeric_limits< double >::quiet_NaN(); }
+        }
+        else
+        {
+            std::unique_ptr< MeanEstimation > mean_estimation = (*_mean)(data);
+            mean = mean_estimation->get_mean(); 
+            std::unique_ptr< VarianceEstimation > variance_estimation = (*_variance)(data, mean);
+            variance = variance_estimation->get_variance(); 
+        }
         if(boost::math::isfinite(mean) && boost::math::isfinite(variance) && variance > mean)
         {
             NegativeBinomialDistribution* negbinomial = new NegativeBinomialDistribution(pow(mean, 2)/(variance - mean), 1. - mean/variance);
@@ -374,6 +654,34 @@ namespace statiskit
 
     std::unique_ptr< UnivariateDistributionEstimation::Estimator > NegativeBinomialDistributionMMEstimation::Estimator::copy() const
     { return std::make_unique< Estimator >(*this); }
+
+    std::unique_ptr< UnivariateDistributionEstimation > NegativeBinomialDistributionMMEstimation::Estimator::operator() (const statistic_type& statistic) const
+    {
+        std::unique_ptr< UnivariateDistributionEstimation > estimation;
+        const UnivariateMomentStatistic* moments = dynamic_cast< const UnivariateMomentStatistic* >(&statistic);
+        const NaturalVarianceEstimation::Estimator* variance_estimator = dynamic_cast< const NaturalVarianceEstimation::Estimator* >(_variance);
+        if(moments && variance_estimator && dynamic_cast< const NaturalMeanEstimation::Estimator* >(_mean))
+        {
+            if(moments->get_total() <= 0.)
+            { throw sample_size_error(1); }
+            double mean = moments->get_mean(), variance = moments->get_variance(variance_estimator->get_bias());
+            if(boost::math::isfinite(mean) && boost::math::isfinite(variance) && variance > mean)
+            { estimation = std::make_unique< LazyEstimation< NegativeBinomialDistribution, DiscreteUnivariateDistributionEstimation > >(new NegativeBinomialDistribution(pow(mean, 2)/(variance - mean), 1. - mean/variance)); }
+            else
+            { throw underdispersion_error(); }
+        }
+        else
+        { estimation = DiscreteUnivariateDistributionEstimation::Estimator::operator() (statistic); }
+        return estimation;
+    }
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator::statistic_type > NegativeBinomialDistributionMMEstimation::Estimator::statistic() const
+    {
+        std::unique_ptr< statistic_type > statistic;
+        if(dynamic_cast< const NaturalMeanEstimation::Estimator* >(_mean) && dynamic_cast< const NaturalVarianceEstimation::Estimator* >(_variance))
+        { statistic = std::make_unique< UnivariateMomentStatistic >(); }
+        return statistic;
+    }
     
     MeanEstimation::Estimator* NegativeBinomialDistributionMMEstimation::Estimator::get_mean()
     { return _mean; }
@@ -410,12 +718,11 @@ namespace statiskit
         if(data.get_sample_space()->get_outcome() != CONTINUOUS)
         { throw statiskit::sample_space_error(CONTINUOUS); }
         std::unique_ptr< UnivariateDistributionEstimation > estimation;
-        NaturalMeanEstimation::Estimator mean_estimator = NaturalMeanEstimation::Estimator();
-        std::unique_ptr< MeanEstimation > mean_estimation = mean_estimator(data);
-        double mean = mean_estimation->get_mean(); 
-        NaturalVarianceEstimation::Estimator variance_estimator = NaturalVarianceEstimation::Estimator(false);
-        std::unique_ptr< VarianceEstimation > variance_estimation = variance_estimator(data, mean);
-        double std_err = sqrt(variance_estimation->get_variance()); 
+        UnivariateMomentStatistic moments = UnivariateMomentStatistic();
+        moments.update(data);
+        if(moments.get_total() <= 0.)
+        { throw sample_size_error(1); }
+        double mean = moments.get_mean(), std_err = sqrt(moments.get_variance(false));
         if(boost::math::isfinite(mean) && boost::math::isfinite(std_err))
         {
             NormalDistribution* normal = new NormalDistribution(mean, std_err);
@@ -430,6 +737,410 @@ namespace statiskit
     std::unique_ptr< UnivariateDistributionEstimation::Estimator > NormalDistributionMLEstimation::Estimator::copy() const
     { return std::make_unique< Estimator >(*this); }
 
+    std::unique_ptr< UnivariateDistributionEstimation > NormalDistributionMLEstimation::Estimator::operator() (const statistic_type& statistic) const
+    {
+        std::unique_ptr< UnivariateDistributionEstimation > estimation;
+        const UnivariateMomentStatistic* moments = dynamic_cast< const UnivariateMomentStatistic* >(&statistic);
+        if(moments)
+        {
+            if(moments->get_total() <= 0.)
+            { throw sample_size_error(1); }
+            double mean = moments->get_mean(), std_err = sqrt(moments->get_variance(false));
+            if(boost::math::isfinite(mean) && boost::math::isfinite(std_err))
+            { estimation = std::make_unique< LazyEstimation< NormalDistribution, ContinuousUnivariateDistributionEstimation > >(new NormalDistribution(mean, std_err)); }
+        }
+        else
+        { estimation = ContinuousUnivariateDistributionEstimation::Estimator::operator() (statistic); }
+        return estimation;
+    }
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator::statistic_type > NormalDistributionMLEstimation::Estimator::statistic() const
+    { return std::make_unique< UnivariateMomentStatistic >(); }
+
+    LaplaceDistributionMLEstimation::LaplaceDistributionMLEstimation() : OptimizationEstimation< LaplaceDistribution*, LaplaceDistribution, ContinuousUnivariateDistributionEstimation >()
+    {}
+
+    LaplaceDistributionMLEstimation::LaplaceDistributionMLEstimation(LaplaceDistribution const * estimated, UnivariateData const * data) : OptimizationEstimation< LaplaceDistribution*, LaplaceDistribution, ContinuousUnivariateDistributionEstimation >(estimated, data)
+    {}
+
+    LaplaceDistributionMLEstimation::LaplaceDistributionMLEstimation(const LaplaceDistributionMLEstimation& estimation) : OptimizationEstimation< LaplaceDistribution*, LaplaceDistribution, ContinuousUnivariateDistributionEstimation >(estimation)
+    {}
+
+    LaplaceDistributionMLEstimation::~LaplaceDistributionMLEstimation()
+    {}
+
+    LaplaceDistributionMLEstimation::Estimator::Estimator() : OptimizationEstimation< LaplaceDistribution*, LaplaceDistribution, ContinuousUnivariateDistributionEstimation >::Estimator()
+    {}
+
+    LaplaceDistributionMLEstimation::Estimator::Estimator(const Estimator& estimator) : OptimizationEstimation< LaplaceDistribution*, LaplaceDistribution, ContinuousUnivariateDistributionEstimation >::Estimator(estimator)
+    {}
+
+    LaplaceDistributionMLEstimation::Estimator::~Estimator()
+    {}
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator > LaplaceDistributionMLEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    std::unique_ptr< UnivariateDistributionEstimation > LaplaceDistributionMLEstimation::Estimator::operator() (const UnivariateData& data, const bool& lazy) const
+    {
+        if(data.get_sample_space()->get_outcome() != CONTINUOUS)
+        { throw statiskit::sample_space_error(CONTINUOUS); }
+        Eigen::ArrayXd values, weights;
+        __impl::observations(data, values, weights);
+        double total = weights.sum();
+        if(!(total > 0.))
+        { throw sample_size_error(1); }
+        double mu = __impl::quantiles(values, weights).get_median();
+        double sigma = (weights * (values - mu).abs()).sum() / total;
+        std::unique_ptr< UnivariateDistributionEstimation > estimation;
+        LaplaceDistribution* estimated = new LaplaceDistribution(mu, sigma);
+        if(lazy)
+        { estimation = std::make_unique< LazyEstimation< LaplaceDistribution, ContinuousUnivariateDistributionEstimation > >(estimated); }
+        else
+        {
+            estimation = std::make_unique< LaplaceDistributionMLEstimation >(estimated, &data);
+            static_cast< LaplaceDistributionMLEstimation* >(estimation.get())->_iterations.push_back(new LaplaceDistribution(mu, sigma));
+        }
+        return estimation;
+    }
+
+    LogisticDistributionMLEstimation::LogisticDistributionMLEstimation() : OptimizationEstimation< LogisticDistribution*, LogisticDistribution, ContinuousUnivariateDistributionEstimation >()
+    {}
+
+    LogisticDistributionMLEstimation::LogisticDistributionMLEstimation(LogisticDistribution const * estimated, UnivariateData const * data) : OptimizationEstimation< LogisticDistribution*, LogisticDistribution, ContinuousUnivariateDistributionEstimation >(estimated, data)
+    {}
+
+    LogisticDistributionMLEstimation::LogisticDistributionMLEstimation(const LogisticDistributionMLEstimation& estimation) : OptimizationEstimation< LogisticDistribution*, LogisticDistribution, ContinuousUnivariateDistributionEstimation >(estimation)
+    {}
+
+    LogisticDistributionMLEstimation::~LogisticDistributionMLEstimation()
+    {}
+
+    LogisticDistributionMLEstimation::Estimator::Estimator() : OptimizationEstimation< LogisticDistribution*, LogisticDistribution, ContinuousUnivariateDistributionEstimation >::Estimator()
+    {}
+
+    LogisticDistributionMLEstimation::Estimator::Estimator(const Estimator& estimator) : OptimizationEstimation< LogisticDistribution*, LogisticDistribution, ContinuousUnivariateDistributionEstimation >::Estimator(estimator)
+    {}
+
+    LogisticDistributionMLEstimation::Estimator::~Estimator()
+    {}
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator > LogisticDistributionMLEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    std::unique_ptr< UnivariateDistributionEstimation > LogisticDistributionMLEstimation::Estimator::operator() (const UnivariateData& data, const bool& lazy) const
+    {
+        if(data.get_sample_space()->get_outcome() != CONTINUOUS)
+        { throw statiskit::sample_space_error(CONTINUOUS); }
+        Eigen::ArrayXd values, weights;
+        __impl::observations(data, values, weights);
+        double total = weights.sum();
+        if(!(total > 0.))
+        { throw sample_size_error(1); }
+        double mean = (weights * values).sum() / total, variance = (weights * (values - mean).square()).sum() / total;
+        double mu = mean, sigma = sqrt(3. * variance) / boost::math::constants::pi<double>();
+        std::vector< LogisticDistribution* > iterations;
+        __impl::location_scale(values, weights, mu, sigma, [](const Eigen::ArrayXd& z, Eigen::ArrayXd& g0, Eigen::ArrayXd& g1, Eigen::ArrayXd& g2)
+        {
+            Eigen::ArrayXd t = (z / 2.).tanh();
+            g0 = - 2. * ((z / 2.).abs() + (- z.abs()).exp().log1p() - log(2.)) - log(4.);
+            g1 = - t;
+            g2 = - (1. - t.square()) / 2.;
+        }, [this](const unsigned int& its, const double& delta) -> bool
+        { return this->run(its, delta); }, [&iterations](const double& mu, const double& sigma)
+        { iterations.push_back(new LogisticDistribution(mu, sigma)); });
+        std::unique_ptr< UnivariateDistributionEstimation > estimation;
+        LogisticDistribution* estimated = new LogisticDistribution(mu, sigma);
+        if(lazy)
+        {
+            estimation = std::make_unique< LazyEstimation< LogisticDistribution, ContinuousUnivariateDistributionEstimation > >(estimated);
+            for(Index index = 0, max_index = iterations.size(); index < max_index; ++index)
+            { delete iterations[index]; }
+        }
+        else
+        {
+            estimation = std::make_unique< LogisticDistributionMLEstimation >(estimated, &data);
+            static_cast< LogisticDistributionMLEstimation* >(estimation.get())->_iterations = iterations;
+        }
+        return estimation;
+    }
+
+    CauchyDistributionMLEstimation::CauchyDistributionMLEstimation() : OptimizationEstimation< CauchyDistribution*, CauchyDistribution, ContinuousUnivariateDistributionEstimation >()
+    {}
+
+    CauchyDistributionMLEstimation::CauchyDistributionMLEstimation(CauchyDistribution const * estimated, UnivariateData const * data) : OptimizationEstimation< CauchyDistribution*, CauchyDistribution, ContinuousUnivariateDistributionEstimation >(estimated, data)
+    {}
+
+    CauchyDistributionMLEstimation::CauchyDistributionMLEstimation(const CauchyDistributionMLEstimation& estimation) : OptimizationEstimation< CauchyDistribution*, CauchyDistribution, ContinuousUnivariateDistributionEstimation >(estimation)
+    {}
+
+    CauchyDistributionMLEstimation::~CauchyDistributionMLEstimation()
+    {}
+
+    CauchyDistributionMLEstimation::Estimator::Estimator() : OptimizationEstimation< CauchyDistribution*, CauchyDistribution, ContinuousUnivariateDistributionEstimation >::Estimator()
+    {}
+
+    CauchyDistributionMLEstimation::Estimator::Estimator(const Estimator& estimator) : OptimizationEstimation< CauchyDistribution*, CauchyDistribution, ContinuousUnivariateDistributionEstimation >::Estimator(estimator)
+    {}
+
+    CauchyDistributionMLEstimation::Estimator::~Estimator()
+    {}
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator > CauchyDistributionMLEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    std::unique_ptr< UnivariateDistributionEstimation > CauchyDistributionMLEstimation::Estimator::operator() (const UnivariateData& data, const bool& lazy) const
+    {
+        if(data.get_sample_space()->get_outcome() != CONTINUOUS)
+        { throw statiskit::sample_space_error(CONTINUOUS); }
+        Eigen::ArrayXd values, weights;
+        __impl::observations(data, values, weights);
+        double total = weights.sum();
+        if(!(total > 0.))
+        { throw sample_size_error(1); }
+        NaturalQuantileEstimation quantiles = __impl::quantiles(values, weights);
+        double mu = quantiles.get_median();
+        double sigma = (quantiles.get_quantile(.75) - quantiles.get_quantile(.25)) / 2.;
+        if(!(sigma > 0.))
+        { sigma = sqrt((weights * (values - mu).square()).sum() / total); }
+        std::vector< CauchyDistribution* > iterations;
+        __impl::location_scale(values, weights, mu, sigma, [](const Eigen::ArrayXd& z, Eigen::ArrayXd& g0, Eigen::ArrayXd& g1, Eigen::ArrayXd& g2)
+        {
+            Eigen::ArrayXd q = 1. + z.square();
+            g0 = - log(boost::math::constants::pi<double>()) - q.log();
+            g1 = - 2. * z / q;
+            g2 = - 2. * (1. - z.square()) / q.square();
+        }, [this](const unsigned int& its, const double& delta) -> bool
+        { return this->run(its, delta); }, [&iterations](const double& mu, const double& sigma)
+        { iterations.push_back(new CauchyDistribution(mu, sigma)); });
+        std::unique_ptr< UnivariateDistributionEstimation > estimation;
+        CauchyDistribution* estimated = new CauchyDistribution(mu, sigma);
+        if(lazy)
+        {
+            estimation = std::make_unique< LazyEstimation< CauchyDistribution, ContinuousUnivariateDistributionEstimation > >(estimated);
+            for(Index index = 0, max_index = iterations.size(); index < max_index; ++index)
+            { delete iterations[index]; }
+        }
+        else
+        {
+            estimation = std::make_unique< CauchyDistributionMLEstimation >(estimated, &data);
+            static_cast< CauchyDistributionMLEstimation* >(estimation.get())->_iterations = iterations;
+        }
+        return estimation;
+    }
+
+    GumbelMaxDistributionMLEstimation::GumbelMaxDistributionMLEstimation() : OptimizationEstimation< GumbelMaxDistribution*, GumbelMaxDistribution, ContinuousUnivariateDistributionEstimation >()
+    {}
+
+    GumbelMaxDistributionMLEstimation::GumbelMaxDistributionMLEstimation(GumbelMaxDistribution const * estimated, UnivariateData const * data) : OptimizationEstimation< GumbelMaxDistribution*, GumbelMaxDistribution, ContinuousUnivariateDistributionEstimation >(estimated, data)
+    {}
+
+    GumbelMaxDistributionMLEstimation::GumbelMaxDistributionMLEstimation(const GumbelMaxDistributionMLEstimation& estimation) : OptimizationEstimation< GumbelMaxDistribution*, GumbelMaxDistribution, ContinuousUnivariateDistributionEstimation >(estimation)
+    {}
+
+    GumbelMaxDistributionMLEstimation::~GumbelMaxDistributionMLEstimation()
+    {}
+
+    GumbelMaxDistributionMLEstimation::Estimator::Estimator() : OptimizationEstimation< GumbelMaxDistribution*, GumbelMaxDistribution, ContinuousUnivariateDistributionEstimation >::Estimator()
+    {}
+
+    GumbelMaxDistributionMLEstimation::Estimator::Estimator(const Estimator& estimator) : OptimizationEstimation< GumbelMaxDistribution*, GumbelMaxDistribution, ContinuousUnivariateDistributionEstimation >::Estimator(estimator)
+    {}
+
+    GumbelMaxDistributionMLEstimation::Estimator::~Estimator()
+    {}
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator > GumbelMaxDistributionMLEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    std::unique_ptr< UnivariateDistributionEstimation > GumbelMaxDistributionMLEstimation::Estimator::operator() (const UnivariateData& data, const bool& lazy) const
+    {
+        if(data.get_sample_space()->get_outcome() != CONTINUOUS)
+        { throw statiskit::sample_space_error(CONTINUOUS); }
+        Eigen::ArrayXd values, weights;
+        __impl::observations(data, values, weights);
+        double total = weights.sum();
+        if(!(total > 0.))
+        { throw sample_size_error(1); }
+        double mean = (weights * values).sum() / total, variance = (weights * (values - mean).square()).sum() / total;
+        double sigma = sqrt(6. * variance) / boost::math::constants::pi<double>();
+        double mu = mean - sigma * boost::math::constants::euler<double>();
+        std::vector< GumbelMaxDistribution* > iterations;
+        __impl::location_scale(values, weights, mu, sigma, [](const Eigen::ArrayXd& z, Eigen::ArrayXd& g0, Eigen::ArrayXd& g1, Eigen::ArrayXd& g2)
+        {
+            Eigen::ArrayXd e = (- z).exp();
+            g0 = - z - e;
+            g1 = e - 1.;
+            g2 = - e;
+        }, [this](const unsigned int& its, const double& delta) -> bool
+        { return this->run(its, delta); }, [&iterations](const double& mu, const double& sigma)
+        { iterations.push_back(new GumbelMaxDistribution(mu, sigma)); });
+        std::unique_ptr< UnivariateDistributionEstimation > estimation;
+        GumbelMaxDistribution* estimated = new GumbelMaxDistribution(mu, sigma);
+        if(lazy)
+        {
+            estimation = std::make_unique< LazyEstimation< GumbelMaxDistribution, ContinuousUnivariateDistributionEstimation > >(estimated);
+            for(Index index = 0, max_index = iterations.size(); index < max_index; ++index)
+            { delete iterations[index]; }
+        }
+        else
+        {
+            estimation = std::make_unique< GumbelMaxDistributionMLEstimation >(estimated, &data);
+            static_cast< GumbelMaxDistributionMLEstimation* >(estimation.get())->_iterations = iterations;
+        }
+        return estimation;
+    }
+
+    GumbelMinDistributionMLEstimation::GumbelMinDistributionMLEstimation() : OptimizationEstimation< GumbelMinDistribution*, GumbelMinDistribution, ContinuousUnivariateDistributionEstimation >()
+    {}
+
+    GumbelMinDistributionMLEstimation::GumbelMinDistributionMLEstimation(GumbelMinDistribution const * estimated, UnivariateData const * data) : OptimizationEstimation< GumbelMinDistribution*, GumbelMinDistribution, ContinuousUnivariateDistributionEstimation >(estimated, data)
+    {}
+
+    GumbelMinDistributionMLEstimation::GumbelMinDistributionMLEstimation(const GumbelMinDistributionMLEstimation& estimation) : OptimizationEstimation< GumbelMinDistribution*, GumbelMinDistribution, ContinuousUnivariateDistributionEstimation >(estimation)
+    {}
+
+    GumbelMinDistributionMLEstimation::~GumbelMinDistributionMLEstimation()
+    {}
+
+    GumbelMinDistributionMLEstimation::Estimator::Estimator() : OptimizationEstimation< GumbelMinDistribution*, GumbelMinDistribution, ContinuousUnivariateDistributionEstimation >::Estimator()
+    {}
+
+    GumbelMinDistributionMLEstimation::Estimator::Estimator(const Estimator& estimator) : OptimizationEstimation< GumbelMinDistribution*, GumbelMinDistribution, ContinuousUnivariateDistributionEstimation >::Estimator(estimator)
+    {}
+
+    GumbelMinDistributionMLEstimation::Estimator::~Estimator()
+    {}
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator > GumbelMinDistributionMLEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    std::unique_ptr< UnivariateDistributionEstimation > GumbelMinDistributionMLEstimation::Estimator::operator() (const UnivariateData& data, const bool& lazy) const
+    {
+        if(data.get_sample_space()->get_outcome() != CONTINUOUS)
+        { throw statiskit::sample_space_error(CONTINUOUS); }
+        Eigen::ArrayXd values, weights;
+        __impl::observations(data, values, weights);
+        double total = weights.sum();
+        if(!(total > 0.))
+        { throw sample_size_error(1); }
+        double mean = (weights * values).sum() / total, variance = (weights * (values - mean).square()).sum() / total;
+        double sigma = sqrt(6. * variance) / boost::math::constants::pi<double>();
+        double mu = mean + sigma * boost::math::constants::euler<double>();
+        std::vector< GumbelMinDistribution* > iterations;
+        __impl::location_scale(values, weights, mu, sigma, [](const Eigen::ArrayXd& z, Eigen::ArrayXd& g0, Eigen::ArrayXd& g1, Eigen::ArrayXd& g2)
+        {
+            Eigen::ArrayXd e = z.exp();
+            g0 = z - e;
+            g1 = 1. - e;
+            g2 = - e;
+        }, [this](const unsigned int& its, const double& delta) -> bool
+        { return this->run(its, delta); }, [&iterations](const double& mu, const double& sigma)
+        { iterations.push_back(new GumbelMinDistribution(mu, sigma)); });
+        std::unique_ptr< UnivariateDistributionEstimation > estimation;
+        GumbelMinDistribution* estimated = new GumbelMinDistribution(mu, sigma);
+        if(lazy)
+        {
+            estimation = std::make_unique< LazyEstimation< GumbelMinDistribution, ContinuousUnivariateDistributionEstimation > >(estimated);
+            for(Index index = 0, max_index = iterations.size(); index < max_index; ++index)
+            { delete iterations[index]; }
+        }
+        else
+        {
+            estimation = std::make_unique< GumbelMinDistributionMLEstimation >(estimated, &data);
+            static_cast< GumbelMinDistributionMLEstimation* >(estimation.get())->_iterations = iterations;
+        }
+        return estimation;
+    }
+
+    NonStandardStudentDistributionMLEstimation::NonStandardStudentDistributionMLEstimation() : OptimizationEstimation< NonStandardStudentDistribution*, NonStandardStudentDistribution, ContinuousUnivariateDistributionEstimation >()
+    {}
+
+    NonStandardStudentDistributionMLEstimation::NonStandardStudentDistributionMLEstimation(NonStandardStudentDistribution const * estimated, UnivariateData const * data) : OptimizationEstimation< NonStandardStudentDistribution*, NonStandardStudentDistribution, ContinuousUnivariateDistributionEstimation >(estimated, data)
+    {}
+
+    NonStandardStudentDistributionMLEstimation::NonStandardStudentDistributionMLEstimation(const NonStandardStudentDistributionMLEstimation& estimation) : OptimizationEstimation< NonStandardStudentDistribution*, NonStandardStudentDistribution, ContinuousUnivariateDistributionEstimation >(estimation)
+    {}
+
+    NonStandardStudentDistributionMLEstimation::~NonStandardStudentDistributionMLEstimation()
+    {}
+
+    NonStandardStudentDistributionMLEstimation::Estimator::Estimator() : OptimizationEstimation< NonStandardStudentDistribution*, NonStandardStudentDistribution, ContinuousUnivariateDistributionEstimation >::Estimator()
+    {}
+
+    NonStandardStudentDistributionMLEstimation::Estimator::Estimator(const Estimator& estimator) : OptimizationEstimation< NonStandardStudentDistribution*, NonStandardStudentDistribution, ContinuousUnivariateDistributionEstimation >::Estimator(estimator)
+    {}
+
+    NonStandardStudentDistributionMLEstimation::Estimator::~Estimator()
+    {}
+
+    std::unique_ptr< UnivariateDistributionEstimation::Estimator > NonStandardStudentDistributionMLEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    std::unique_ptr< UnivariateDistributionEstimation > NonStandardStudentDistributionMLEstimation::Estimator::operator() (const UnivariateData& data, const bool& lazy) const
+    {
+        if(data.get_sample_space()->get_outcome() != CONTINUOUS)
+        { throw statiskit::sample_space_error(CONTINUOUS); }
+        Eigen::ArrayXd values, weights;
+        __impl::observations(data, values, weights);
+        double total = weights.sum();
+        if(!(total > 0.))
+        { throw sample_size_error(1); }
+        NaturalQuantileEstimation quantiles = __impl::quantiles(values, weights);
+        double mu = quantiles.get_median();
+        double sigma = (quantiles.get_quantile(.75) - quantiles.get_quantile(.25)) / 1.349;
+        if(!(sigma > 0.))
+        { sigma = sqrt((weights * (values - mu).square()).sum() / total); }
+        double nu = 5., prev_mu, prev_sigma, prev_nu;
+        const double min_nu = 1e-2, max_nu = 1e6;
+        Eigen::ArrayXd d, u;
+        // Score of the observed log-likelihood with respect to nu, given the squared standardized residuals d
+        auto score = [&d, &weights, &total](const double& theta) -> double
+        {
+            double nu = exp(theta);
+            return total * (boost::math::digamma((nu + 1.) / 2.) - boost::math::digamma(nu / 2.) - 1. / nu) / 2. + (weights * ((nu + 1.) * d / (nu * (nu + d)) - (d / nu).log1p())).sum() / 2.;
+        };
+        std::vector< NonStandardStudentDistribution* > iterations;
+        unsigned int its = 0;
+        do
+        {
+            prev_mu = mu;
+            prev_sigma = sigma;
+            prev_nu = nu;
+            u = (nu + 1.) / (nu + ((values - mu) / sigma).square());
+            mu = (weights * u * values).sum() / (weights * u).sum();
+            sigma = sqrt((weights * u * (values - mu).square()).sum() / total);
+            d = ((values - mu) / sigma).square();
+            double lower = log(min_nu), upper = log(max_nu);
+            if(!(score(upper) < 0.))
+            { nu = max_nu; }
+            else if(!(score(lower) > 0.))
+            { nu = min_nu; }
+            else
+            {
+                boost::uintmax_t max_iter = 100;
+                std::pair< double, double > bracket = boost::math::tools::toms748_solve(score, lower, upper, boost::math::tools::eps_tolerance< double >(30), max_iter);
+                nu = exp((bracket.first + bracket.second) / 2.);
+            }
+            iterations.push_back(new NonStandardStudentDistribution(mu, sigma, nu));
+            ++its;
+        } while(run(its, std::max(fabs(mu - prev_mu) / sigma, std::max(fabs(log(sigma / prev_sigma)), fabs(log(nu / prev_nu))))));
+        std::unique_ptr< UnivariateDistributionEstimation > estimation;
+        NonStandardStudentDistribution* estimated = new NonStandardStudentDistribution(mu, sigma, nu);
+        if(lazy)
+        {
+            estimation = std::make_unique< LazyEstimation< NonStandardStudentDistribution, ContinuousUnivariateDistributionEstimation > >(estimated);
+            for(Index index = 0, max_index = iterations.size(); index < max_index; ++index)
+            { delete iterations[index]; }
+        }
+        else
+        {
+            estimation = std::make_unique< NonStandardStudentDistributionMLEstimation >(estimated, &data);
+            static_cast< NonStandardStudentDistributionMLEstimation* >(estimation.get())->_iterations = iterations;
+        }
+        return estimation;
+    }
+
     UnivariateHistogramDistributionEstimation::UnivariateHistogramDistributionEstimation() : ActiveEstimation< UnivariateHistogramDistribution, ContinuousUnivariateDistributionEstimation >()
     {}
 
@@ -559,19 +1270,78 @@ namespace statiskit
         { cache = new RegularUnivariateHistogramDistributionSlopeHeuristicSelection(nullptr); }
         else
         { cache = new RegularUnivariateHistogramDistributionSlopeHeuristicSelection(&data); }
-        std::set< double > bins = std::set< double >();
-        UnivariateHistogramDistributionEstimation::Estimator estimator = UnivariateHistogramDistributionEstimation::Estimator();
-        for(Index nb_bins = _maxbins; nb_bins > 0; --nb_bins)
+        // Sort elementary values once, bin counts of every candidate are then obtained by cumulative weights
+        std::vector< std::pair< double, double > > elementaries;
+        std::vector< std::pair< const UnivariateEvent*, double > > censored;
+        std::unique_ptr< UnivariateData::Generator > generator = data.generator();
+        while(generator->is_valid())
         {
-            estimator.set_nb_bins(nb_bins);
-            try
+            const UnivariateEvent* event = generator->event();
+            if(event)
             {
-                std::unique_ptr< UnivariateDistributionEstimation > estimation = estimator(data, true);
-                UnivariateHistogramDistribution* estimated = const_cast< UnivariateHistogramDistribution* >(static_cast< const UnivariateHistogramDistribution* >(estimation->get_estimated()));
-                cache->add(estimated->get_nb_parameters(), estimated->loglikelihood(data), static_cast< UnivariateHistogramDistribution* >(estimated->copy().release()));
-            } 
-            catch(const std::exception& error)
-            {}
+                if(event->get_event() == ELEMENTARY)
+                { elementaries.push_back(std::make_pair(static_cast< const ContinuousElementaryEvent* >(event)->get_value(), generator->weight())); }
+                else
+                { censored.push_back(std::make_pair(event, generator->weight())); }
+            }
+            ++(*generator);
+        }
+        std::sort(elementaries.begin(), elementaries.end());
+        std::vector< double > values(elementaries.size()), cumulatives(elementaries.size() + 1, 0.);
+        for(Index index = 0, max_index = elementaries.size(); index < max_index; ++index)
+        {
+            values[index] = elementaries[index].first;
+            cumulatives[index + 1] = cumulatives[index] + elementaries[index].second;
+        }
+        elementaries.clear();
+        if(values.size() > 0)
+        {
+            double total = cumulatives.back(), min = values.front(), max = values.back();
+            std::vector< UnivariateHistogramDistribution* > proposals(_maxbins, nullptr);
+            std::vector< double > scores(_maxbins, std::numeric_limits< double >::quiet_NaN());
+            __impl::parallel_for(_maxbins, [this, &values, &cumulatives, &censored, &proposals, &scores, total, min, max](const Index& shift)
+            {
+                Index nb_bins = _maxbins - shift;
+                try
+                {
+                    std::vector< double > bins(1, min - .5 / total * (max - min));
+                    for(Index index = 1; index < nb_bins; ++index)
+                    { bins.push_back(bins.back() + 1. / nb_bins * (max-min)); }
+                    bins.push_back(max + .5 / nb_bins * (max - min));
+                    std::set< double > _bins(bins.cbegin(), bins.cend());
+                    if(_bins.size() != bins.size())
+                    { throw sample_size_error(1); }
+                    std::vector< double > counts(nb_bins), densities(nb_bins);
+                    double prev = 0.;
+                    for(Index index = 0; index < nb_bins; ++index)
+                    {
+                        double curr = total;
+                        if(index + 1 < nb_bins)
+                        { curr = cumulatives[distance(values.cbegin(), std::lower_bound(values.cbegin(), values.cend(), bins[index + 1]))]; }
+                        counts[index] = curr - prev;
+                        densities[index] = counts[index] / ((bins[index + 1] - bins[index]) * total);
+                        prev = curr;
+                    }
+                    std::unique_ptr< UnivariateHistogramDistribution > estimated = std::make_unique< UnivariateHistogramDistribution >(_bins, densities);
+                    double score = 0.;
+                    for(Index index = 0; index < nb_bins; ++index)
+                    {
+                        if(counts[index] > 0.)
+                        { score += counts[index] * log(estimated->get_densities()[index]); }
+                    }
+                    for(Index index = 0, max_index = censored.size(); index < max_index && boost::math::isfinite(score); ++index)
+                    { score += censored[index].second * estimated->probability(censored[index].first, true); }
+                    proposals[shift] = estimated.release();
+                    scores[shift] = score;
+                } 
+                catch(const std::exception& error)
+                {}
+            });
+            for(Index shift = 0; shift < _maxbins; ++shift)
+            {
+                if(proposals[shift])
+                { cache->add(proposals[shift]->get_nb_parameters(), scores[shift], proposals[shift]); }
+            }
         }
         cache->finalize();
         std::unique_ptr< UnivariateDistributionEstimation > estimation;
@@ -603,11 +1373,60 @@ namespace statiskit
     {}
 
     IrregularUnivariateHistogramDistributionSlopeHeuristicSelection::IrregularUnivariateHistogramDistributionSlopeHeuristicSelection(const IrregularUnivariateHistogramDistributionSlopeHeuristicSelection& selection) : SlopeHeuristicSelection< ContinuousUnivariateDistributionEstimation >(selection)
-    {}
+    {
+        _bins = selection._bins;
+        _densities = selection._densities;
+        _merges = selection._merges;
+        _steps = selection._steps;
+    }
     
     IrregularUnivariateHistogramDistributionSlopeHeuristicSelection::~IrregularUnivariateHistogramDistributionSlopeHeuristicSelection()
     {}
 
+    const UnivariateDistribution* IrregularUnivariateHistogramDistributionSlopeHeuristicSelection::get_proposal(const Index& index) const
+    {
+        if(index >= size())
+        { throw size_error("index", size(), size_error::inferior); }
+        std::lock_guard< std::mutex > lock(_mutex);
+        if(!_proposals[index])
+        {
+            // Replay the first merges on the initial regular histogram
+            std::vector< Index > prev(_densities.size()), next(_densities.size()), lefts(_densities.size());
+            std::vector< double > lengths(_densities.size()), densities = _densities;
+            for(Index bin = 0, max_bin = _densities.size(); bin < max_bin; ++bin)
+            {
+                prev[bin] = bin - 1;
+                next[bin] = bin + 1;
+                lefts[bin] = bin;
+                lengths[bin] = _bins[bin + 1] - _bins[bin];
+            }
+            Index first = 0;
+            for(Index step = 0, max_step = _steps[index]; step < max_step; ++step)
+            {
+                Index left = _merges[step], right = next[left];
+                densities[right] = lengths[left] * densities[left] + lengths[right] * densities[right];
+                densities[right] /= lengths[left] + lengths[right];
+                lengths[right] = lengths[left] + lengths[right];
+                lefts[right] = lefts[left];
+                prev[right] = prev[left];
+                if(left == first)
+                { first = right; }
+                else
+                { next[prev[left]] = right; }
+            }
+            std::set< double > bins;
+            std::vector< double > values;
+            for(Index bin = first, max_bin = densities.size(); bin < max_bin; bin = next[bin])
+            {
+                bins.insert(bins.end(), _bins[lefts[bin]]);
+                values.push_back(densities[bin]);
+            }
+            bins.insert(bins.end(), _bins.back());
+            const_cast< IrregularUnivariateHistogramDistributionSlopeHeuristicSelection* >(this)->_proposals[index] = new UnivariateHistogramDistribution(bins, values);
+        }
+        return _proposals[index];
+    }
+
     IrregularUnivariateHistogramDistributionSlopeHeuristicSelection::Estimator::Estimator()
     {
         _maxbins = 100; 
@@ -632,8 +1451,6 @@ namespace statiskit
         { cache = new IrregularUnivariateHistogramDistributionSlopeHeuristicSelection(nullptr); }
         else
         { cache = new IrregularUnivariateHistogramDistributionSlopeHeuristicSelection(&data); }
-        std::set< double > bins = std::set< double >();
-        unsigned int elements = 0;
         double total = 0., min = std::numeric_limits< double >::infinity(), max = -1 * std::numeric_limits< double >::infinity();
         std::unique_ptr< UnivariateData::Generator > generator = data.generator();
         while(generator->is_valid())
@@ -648,106 +1465,118 @@ namespace statiskit
             }
             ++(*generator);
         }
-        bins.insert(min - .5 / _maxbins * (max - min));
+        std::vector< double >& bins = cache->_bins;
+        bins.push_back(min - .5 / _maxbins * (max - min));
         for(Index index = 1; index < _maxbins; ++index)
-        { bins.insert(*(bins.rbegin()) + 1. / _maxbins * (max-min)); }
-        bins.insert(max + .5 / _maxbins * (max - min));
-        if(bins.size() > 1)
+        { bins.push_back(bins.back() + 1. / _maxbins * (max-min)); }
+        bins.push_back(max + .5 / _maxbins * (max - min));
+        for(Index index = 1, max_index = bins.size(); index < max_index; ++index)
         {
-            std::vector< double > lengths = std::vector< double >(bins.size()-1, 0.);
-            std::set< double >::iterator itl = bins.begin(), itr, it_end = bins.end();
-            itr = itl;
-            ++itr;
-            while(itr != it_end)
+            if(!(bins[index - 1] < bins[index]))
             {
-                lengths[distance(bins.begin(), itl)] = *itr - *itl;
-                ++itl;
-                ++itr;
+                delete cache;
+                throw sample_size_error(1);
             }
-            std::vector< double > densities = std::vector< double >(bins.size()-1, 0.);
-            std::set< double >::iterator it;
-            generator = data.generator();
-            while(generator->is_valid())
+        }
+        std::vector< double > lengths = std::vector< double >(bins.size()-1, 0.);
+        for(Index index = 0, max_index = lengths.size(); index < max_index; ++index)
+        { lengths[index] = bins[index + 1] - bins[index]; }
+        std::vector< double >& densities = cache->_densities;
+        densities = std::vector< double >(bins.size()-1, 0.);
+        generator = data.generator();
+        while(generator->is_valid())
+        {
+            const UnivariateEvent* event = generator->event();
+            if(event)
             {
-                const UnivariateEvent* event = generator->event();
-                if(event)
+                if(event->get_event() == ELEMENTARY)
                 {
-                    if(event->get_event() == ELEMENTARY)
-                    {
-                        it = bins.upper_bound(static_cast< const ContinuousElementaryEvent* >(event)->get_value());
-                        if(it == bins.end())
-                        { densities.back() += generator->weight() /(lengths.back() * total); }
-                        else if(it == bins.begin())
-                        { densities.front() +=  generator->weight() /(lengths.front() * total); }
-                        else
-                        { densities[distance(bins.begin(), it) - 1] += generator->weight() /(lengths[distance(bins.begin(), it) - 1] * total); }
-                    }
+                    Index index = distance(bins.cbegin(), std::upper_bound(bins.cbegin(), bins.cend(), static_cast< const ContinuousElementaryEvent* >(event)->get_value()));
+                    if(index == bins.size())
+                    { densities.back() += generator->weight() /(lengths.back() * total); }
+                    else if(index == 0)
+                    { densities.front() +=  generator->weight() /(lengths.front() * total); }
+                    else
+                    { densities[index - 1] += generator->weight() /(lengths[index - 1] * total); }
                 }
-                ++(*generator);
             }
-            std::vector< double > entropies = std::vector< double >(densities.size()-1, std::numeric_limits< double >::quiet_NaN());
-            for(Index index = 0, max_index = densities.size()-1; index < max_index; ++index)
-            {
-                entropies[index] = 0;
-                if(densities[index] > 0.)
-                { entropies[index] += lengths[index] * densities[index] * log(densities[index]); }
-                if(densities[index + 1] > 0.)
-                { entropies[index] += lengths[index + 1] * densities[index + 1] * log(densities[index + 1]); }
-                double p = (lengths[index] * densities[index] + lengths[index + 1] * densities[index+1]) / (lengths[index] + lengths[index + 1]);
-                if(p > 0.)
-                { entropies[index] -= (lengths[index] + lengths[index + 1]) * p * log(p); }
-                else
-                { entropies[index] = std::numeric_limits< double >::infinity(); }
+            ++(*generator);
+        }
+        // Bins are stored in a doubly linked list and pairwise merge costs in an ordered set indexed by their left bin
+        Index nb_bins = densities.size();
+        std::vector< Index > prev(nb_bins), next(nb_bins);
+        std::vector< double > current = densities, entropies(nb_bins, std::numeric_limits< double >::quiet_NaN());
+        std::set< std::pair< double, Index > > costs;
+        auto entropy = [&lengths, &current](const Index& left, const Index& right) -> double
+        {
+            double entropy = 0;
+            if(current[left] > 0.)
+            { entropy += lengths[left] * current[left] * log(current[left]); }
+            if(current[right] > 0.)
+            { entropy += lengths[right] * current[right] * log(current[right]); }
+            double p = (lengths[left] * current[left] + lengths[right] * current[right]) / (lengths[left] + lengths[right]);
+            if(p > 0.)
+            { entropy -= (lengths[left] + lengths[right]) * p * log(p); }
+            else
+            { entropy = std::numeric_limits< double >::infinity(); }
+            return entropy;
+        };
+        for(Index bin = 0; bin < nb_bins; ++bin)
+        {
+            prev[bin] = bin - 1;
+            next[bin] = bin + 1;
+            if(bin + 1 < nb_bins)
+            {
+                entropies[bin] = entropy(bin, bin + 1);
+                costs.insert(std::make_pair(entropies[bin], bin));
             }
-            double score = 0.;
-            while(bins.size() > 2)
+        }
+        std::map< double, std::pair< double, Index > > steps;
+        std::vector< Index >& merges = cache->_merges;
+        double score = 0.;
+        while(nb_bins > 1)
+        {
+            Index left = costs.begin()->second, right = next[left];
+            if(costs.begin()->first > 0)
             {
-                std::vector< double >::iterator it = std::min_element(entropies.begin(), entropies.end()), itr;
-                if(*it > 0)
+                score -= costs.begin()->first;
+                double penshape = nb_bins;
+                penshape = penshape * (1 + _constant * log(_maxbins) - _constant * log(penshape));
+                if(boost::math::isfinite(penshape) && boost::math::isfinite(score))
                 {
-                    score -= *it;
-                    // if(bins.size() < _maxbins)
-                    // {
-                        UnivariateHistogramDistribution* current = new UnivariateHistogramDistribution(bins, densities);
-                        double penshape = bins.size()-1;
-                        penshape = penshape * (1 + _constant * log(_maxbins) - _constant * log(penshape));
-                        cache->add(penshape, score, current);
-                    // }
-                }
-                itr = it;
-                ++itr;
-                densities[distance(entropies.begin(), itr)] = lengths[distance(entropies.begin(), it)] * densities[distance(entropies.begin(), it)] + lengths[distance(entropies.begin(), itr)] * densities[distance(entropies.begin(), itr)];
-                densities[distance(entropies.begin(), itr)] /= lengths[distance(entropies.begin(), it)] + lengths[distance(entropies.begin(), itr)];
-                lengths[distance(entropies.begin(), itr)] = lengths[distance(entropies.begin(), it)] + lengths[distance(entropies.begin(), itr)];
-                std::vector< double >::iterator itd = densities.begin();
-                advance(itd, distance(entropies.begin(), it));
-                densities.erase(itd);
-                std::vector< double >::iterator itl = lengths.begin();
-                advance(itl, distance(entropies.begin(), it));
-                lengths.erase(itl);
-                std::set< double >::iterator itb = bins.begin();
-                advance(itb, distance(entropies.begin(), itr));
-                bins.erase(itb);
-                // TODO optimize
-                entropies = std::vector< double >(densities.size()-1, std::numeric_limits< double >::quiet_NaN());
-                for(Index index = 0, max_index = densities.size()-1; index < max_index; ++index)
-                { 
-                    entropies[index] = 0;
-                    if(densities[index] > 0.)
-                    { entropies[index] += lengths[index] * densities[index] * log(densities[index]); }
-                    if(densities[index + 1] > 0.)
-                    { entropies[index] += lengths[index + 1] * densities[index + 1] * log(densities[index + 1]); }
-                    double p = (lengths[index] * densities[index] + lengths[index + 1] * densities[index+1]) / (lengths[index] + lengths[index + 1]);
-                    if(p > 0.)
-                    { entropies[index] -= (lengths[index] + lengths[index + 1]) * p * log(p); }
-                    else
-                    { entropies[index] = std::numeric_limits< double >::infinity(); }
+                    std::map< double, std::pair< double, Index > >::iterator it = steps.find(penshape);
+                    if(it == steps.end())
+                    { steps[penshape] = std::make_pair(score, merges.size()); }
+                    else if(it->second.first < score)
+                    { it->second = std::make_pair(score, merges.size()); }
+                    cache->add(penshape, score, nullptr);
                 }
             }
-            cache->finalize();
+            costs.erase(costs.begin());
+            current[right] = lengths[left] * current[left] + lengths[right] * current[right];
+            current[right] /= lengths[left] + lengths[right];
+            lengths[right] = lengths[left] + lengths[right];
+            prev[right] = prev[left];
+            if(prev[left] < densities.size())
+            {
+                next[prev[left]] = right;
+                costs.erase(std::make_pair(entropies[prev[left]], prev[left]));
+                entropies[prev[left]] = entropy(prev[left], right);
+                costs.insert(std::make_pair(entropies[prev[left]], prev[left]));
+            }
+            if(next[right] < densities.size())
+            {
+                costs.erase(std::make_pair(entropies[right], right));
+                entropies[right] = entropy(right, next[right]);
+                costs.insert(std::make_pair(entropies[right], right));
+            }
+            merges.push_back(left);
+            --nb_bins;
         }
-        else
-        { throw sample_size_error(1); }
+        cache->_steps = std::vector< Index >(cache->size());
+        for(Index index = 0, max_index = cache->size(); index < max_index; ++index)
+        { cache->_steps[index] = steps[cache->get_penshape(index)].second; }
+        cache->finalize();
         std::unique_ptr< UnivariateDistributionEstimation > estimation;
         if(lazy)
         {
@@ -802,7 +1631,10 @@ namespace statiskit
     { return _sum; }
 
     MultinomialSplittingDistributionEstimation::Estimator::Estimator()
-    { _sum = nullptr; }
+    {
+        _sum = nullptr;
+        _compress = false;
+    }
 
     MultinomialSplittingDistributionEstimation::Estimator::Estimator(const Estimator& estimator)
     {
@@ -810,6 +1642,7 @@ namespace statiskit
         { _sum = static_cast< DiscreteUnivariateDistributionEstimation::Estimator* >(estimator._sum->copy().release()); }
         else
         { _sum = nullptr; }
+        _compress = estimator._compress;
     }
 
     MultinomialSplittingDistributionEstimation::Estimator::~Estimator()
@@ -823,23 +1656,12 @@ namespace statiskit
 
     std::unique_ptr< MultivariateDistributionEstimation > MultinomialSplittingDistributionEstimation::Estimator::operator() (const MultivariateData& data, const bool& lazy) const
     {
-        SumData sum_data = SumData(&data);
+        if(!_sum)
+        { throw member_error("sum", "you must give an estimator for the sum distribution"); }
+        SumData sum_data = SumData(data, _compress);
         DiscreteUnivariateDistributionEstimation* sum_estimation = static_cast< DiscreteUnivariateDistributionEstimation* >(((*_sum)(sum_data, lazy)).release());
         std::unique_ptr< MultivariateDistributionEstimation > estimation;
-        std::unique_ptr< MultivariateData::Generator > generator = data.generator();
-        Eigen::VectorXd pi = Eigen::VectorXd::Zero(generator->event()->size());
-        while(generator->is_valid())
-        {
-            const MultivariateEvent* mevent = generator->event();
-            for(Index component = 0, max_component = mevent->size(); component < max_component; ++component)
-            {
-                const UnivariateEvent* uevent = mevent->get(component);
-                if(uevent && uevent->get_outcome() == DISCRETE && uevent->get_event() == ELEMENTARY)
-                { pi[component] += generator->weight() * static_cast< const DiscreteElementaryEvent* >(uevent)->get_value(); }
-            }
-            ++(*generator);
-        }
-        MultinomialSplittingDistribution* estimated = new MultinomialSplittingDistribution(static_cast< const DiscreteUnivariateDistribution& >(*(sum_estimation->get_estimated())), pi);
+        MultinomialSplittingDistribution* estimated = new MultinomialSplittingDistribution(static_cast< const DiscreteUnivariateDistribution& >(*(sum_estimation->get_estimated())), sum_data.get_pi());
         if(lazy)
         { 
             estimation = std::make_unique< LazyEstimation< MultinomialSplittingDistribution, DiscreteMultivariateDistributionEstimation > >(estimated);
@@ -860,36 +1682,64 @@ namespace statiskit
     { return _sum; }
 
     void MultinomialSplittingDistributionEstimation::Estimator::set_sum(const DiscreteUnivariateDistributionEstimation::Estimator& sum)
-    { _sum = static_cast< DiscreteUnivariateDistributionEstimation::Estimator* >(sum.copy().release()); }
-
-    // std::unique_ptr< UnivariateData > MultinomialSplittingDistributionEstimation::Estimator::compute_sum(const MultivariateData& data) const
-    // {
-    //     UnivariateDataFrame* sum_data = new UnivariateDataFrame(get_NN());
-    //     std::unique_ptr< MultivariateData::Generator > generator = data.generator();
-    //     while(generator->is_valid())
-    //     {
-    //         int value = 0;
-    //         const MultivariateEvent* mevent = generator->event();
-    //         for(Index component = 0, max_component = mevent->size(); component < max_component; ++component)
-    //         {
-    //             const UnivariateEvent* uevent = mevent->get(component);
-    //             if(uevent && uevent->get_outcome() == DISCRETE && uevent->get_event() == ELEMENTARY)
-    //             { value += static_cast< const DiscreteElementaryEvent* >(uevent)->get_value(); }
-    //         }
-    //         sum_data->add_event(new DiscreteElementaryEvent(value));
-    //         ++(*generator);
-    //     }
-    //     return std::move(std::unique_ptr< UnivariateData >(sum_data));
-    // }
-
-    MultinomialSplittingDistributionEstimation::Estimator::SumData::SumData(const MultivariateData* data)
-    { _data = data; }
+    {
+        if(_sum)
+        { delete _sum; }
+        _sum = static_cast< DiscreteUnivariateDistributionEstimation::Estimator* >(sum.copy().release());
+    }
+
+    bool MultinomialSplittingDistributionEstimation::Estimator::get_compress() const
+    { return _compress; }
+
+    void MultinomialSplittingDistributionEstimation::Estimator::set_compress(const bool& compress)
+    { _compress = compress; }
+
+    MultinomialSplittingDistributionEstimation::Estimator::SumData::SumData(const MultivariateData& data, const bool& compress)
+    {
+        std::map< int, double > frequencies;
+        std::unique_ptr< MultivariateData::Generator > generator = data.generator();
+        _pi = Eigen::VectorXd::Zero(data.get_sample_space()->size());
+        while(generator->is_valid())
+        {
+            int value = 0;
+            double weight = generator->weight();
+            const MultivariateEvent* mevent = generator->event();
+            for(Index component = 0, max_component = mevent->size(); component < max_component; ++component)
+            {
+                const UnivariateEvent* uevent = mevent->get(component);
+                if(uevent && uevent->get_outcome() == DISCRETE && uevent->get_event() == ELEMENTARY)
+                {
+                    int uvalue = static_cast< const DiscreteElementaryEvent* >(uevent)->get_value();
+                    value += uvalue;
+                    _pi[component] += weight * uvalue;
+                }
+            }
+            if(compress)
+            { frequencies[value] += weight; }
+            else
+            {
+                _events.push_back(DiscreteElementaryEvent(value));
+                _weights.push_back(weight);
+            }
+            ++(*generator);
+        }
+        if(compress)
+        {
+            _events.reserve(frequencies.size());
+            _weights.reserve(frequencies.size());
+            for(std::map< int, double >::const_iterator it = frequencies.cbegin(), it_end = frequencies.cend(); it != it_end; ++it)
+            {
+                _events.push_back(DiscreteElementaryEvent(it->first));
+                _weights.push_back(it->second);
+            }
+        }
+    }
 
     MultinomialSplittingDistributionEstimation::Estimator::SumData::~SumData()
     {}
 
     std::unique_ptr< UnivariateData::Generator > MultinomialSplittingDistributionEstimation::Estimator::SumData::generator() const
-    { return std::make_unique< MultinomialSplittingDistributionEstimation::Estimator::SumData::Generator >(_data); }
+    { return std::make_unique< MultinomialSplittingDistributionEstimation::Estimator::SumData::Generator >(this); }
 
     const UnivariateSampleSpace* MultinomialSplittingDistributionEstimation::Estimator::SumData::get_sample_space() const
     { return &get_NN(); }
@@ -897,22 +1747,17 @@ namespace statiskit
     std::unique_ptr< UnivariateData > MultinomialSplittingDistributionEstimation::Estimator::SumData::copy() const
     {
         UnivariateDataFrame* data = new UnivariateDataFrame(get_NN());
-        std::unique_ptr< UnivariateData::Generator > _generator = generator();
-        while(_generator->is_valid())
-        {
-            data->add_event(_generator->event());
-            ++(*_generator);
-        }
-        _generator = generator();
+        for(Index index = 0, max_index = _events.size(); index < max_index; ++index)
+        { data->add_event(&_events[index]); }
         WeightedSumData* weighted = new WeightedSumData(data);
         for(Index index = 0, max_index = weighted->get_nb_weights(); index < max_index; ++index)
-        {
-            weighted->set_weight(index, _generator->weight());
-            ++(*_generator);
-        }
+        { weighted->set_weight(index, _weights[index]); }
         return std::unique_ptr< UnivariateData >(weighted);
     }
 
+    const Eigen::VectorXd& MultinomialSplittingDistributionEstimation::Estimator::SumData::get_pi() const
+    { return _pi; }
+
     MultinomialSplittingDistributionEstimation::Estimator::WeightedSumData::WeightedSumData(const UnivariateData* data)
     { init(data); }
 
@@ -926,49 +1771,29 @@ namespace statiskit
     MultinomialSplittingDistributionEstimation::Estimator::WeightedSumData::~WeightedSumData()
     { delete _data; }
 
-    MultinomialSplittingDistributionEstimation::Estimator::SumData::Generator::Generator(const MultivariateData* data)
+    MultinomialSplittingDistributionEstimation::Estimator::SumData::Generator::Generator(const SumData* data)
     {
-       _sum = nullptr;
-       _generator = data->generator().release();
+       _data = data;
+       _index = 0;
     }
 
     MultinomialSplittingDistributionEstimation::Estimator::SumData::Generator::~Generator()
-    {
-        if(_sum)
-        { delete _sum; }
-        _sum = nullptr;
-        if(_generator)
-        { delete _generator; }
-        _generator = nullptr;
-    }
+    {}
 
     bool MultinomialSplittingDistributionEstimation::Estimator::SumData::Generator::is_valid() const
-    { return _generator->is_valid(); }
+    { return _index < _data->_events.size(); }
 
     UnivariateData::Generator& MultinomialSplittingDistributionEstimation::Estimator::SumData::Generator::operator++()
     {
-       ++(*_generator);
+       ++_index;
        return *this;
     }
 
     const UnivariateEvent* MultinomialSplittingDistributionEstimation::Estimator::SumData::Generator::event() const
-    {
-        if(_sum)
-        { delete _sum; }
-        int value = 0;
-        const MultivariateEvent* mevent = _generator->event();
-        for(Index component = 0, max_component = mevent->size(); component < max_component; ++component)
-        {
-            const UnivariateEvent* uevent = mevent->get(component);
-            if(uevent && uevent->get_outcome() == DISCRETE && uevent->get_event() == ELEMENTARY)
-            { value += static_cast< const DiscreteElementaryEvent* >(uevent)->get_value(); }
-        }
-        _sum = new DiscreteElementaryEvent(value);
-        return _sum;
-    }
+    { return &(_data->_events[_index]); }
 
     double MultinomialSplittingDistributionEstimation::Estimator::SumData::Generator::weight() const
-    { return _generator->weight(); }
+    { return _data->_weights[_index]; }
     
     UnivariateConditionalDistributionEstimation::~UnivariateConditionalDistributionEstimation()
     {}
@@ -85,6 +85,9 @@ namespace statiskit
             virtual ~Estimator();
 
             virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
+            virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const statistic_type& statistic) const;
+
+            virtual std::unique_ptr< statistic_type > statistic() const;
 
             virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
         };
@@ -131,6 +134,9 @@ namespace statiskit
                 virtual ~Estimator();
 
                 virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
+                virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const statistic_type& statistic) const;
+
+                virtual std::unique_ptr< statistic_type > statistic() const;
 
                 virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
 
@@ -212,6 +218,9 @@ namespace statiskit
                  *          \f]
                  * */
                 virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
+                virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const statistic_type& statistic) const;
+
+                virtual std::unique_ptr< statistic_type > statistic() const;
 
                 virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
 
@@ -243,11 +252,172 @@ namespace statiskit
             virtual ~Estimator();
 
             virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const; 
+            virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const statistic_type& statistic) const;
+
+            virtual std::unique_ptr< statistic_type > statistic() const;
 
             virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
         };
     };
-   
+
+    struct STATISKIT_CORE_API LaplaceDistributionMLEstimation : OptimizationEstimation< LaplaceDistribution*, LaplaceDistribution, ContinuousUnivariateDistributionEstimation >
+    {
+        LaplaceDistributionMLEstimation();
+        LaplaceDistributionMLEstimation(LaplaceDistribution const * estimated, UnivariateData const * data);
+        LaplaceDistributionMLEstimation(const LaplaceDistributionMLEstimation& estimation);
+        virtual ~LaplaceDistributionMLEstimation();
+
+        /** \brief Maximum likelihood estimator of the Laplace distribution parameters \f$\mu\f$ and \f$\sigma\f$.
+         *
+         * \details The estimates are given in closed form.
+         *          \f$\mu\f$ is the weighted median of the observations, computed on the sorted observations, and \f$\sigma\f$ is the mean absolute deviation around it
+         *          \f[
+         *              \sigma = \frac{1}{n} \sum_{i = 1}^{n} \left\vert x_i - \mu \right\vert.
+         *          \f]
+         * */
+        class STATISKIT_CORE_API Estimator : public OptimizationEstimation< LaplaceDistribution*, LaplaceDistribution, ContinuousUnivariateDistributionEstimation >::Estimator
+        {
+            public:
+                Estimator();
+                Estimator(const Estimator& estimator);
+                virtual ~Estimator();
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
+        };
+    };
+
+    struct STATISKIT_CORE_API LogisticDistributionMLEstimation : OptimizationEstimation< LogisticDistribution*, LogisticDistribution, ContinuousUnivariateDistributionEstimation >
+    {
+        LogisticDistributionMLEstimation();
+        LogisticDistributionMLEstimation(LogisticDistribution const * estimated, UnivariateData const * data);
+        LogisticDistributionMLEstimation(const LogisticDistributionMLEstimation& estimation);
+        virtual ~LogisticDistributionMLEstimation();
+
+        /** \brief Maximum likelihood estimator of the logistic distribution parameters \f$\mu\f$ and \f$\sigma\f$.
+         *
+         * \details Starting from the moment estimates, Newton iterations are performed on \f$\left(\mu, \log \sigma\right)\f$.
+         *          The score and the Hessian are accumulated in a single pass over the observations and each step is halved until the log-likelihood increases.
+         *          If the Hessian is not negative definite, a scaled gradient step is used instead.
+         * */
+        class STATISKIT_CORE_API Estimator : public OptimizationEstimation< LogisticDistribution*, LogisticDistribution, ContinuousUnivariateDistributionEstimation >::Estimator
+        {
+            public:
+                Estimator();
+                Estimator(const Estimator& estimator);
+                virtual ~Estimator();
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
+        };
+    };
+
+    struct STATISKIT_CORE_API CauchyDistributionMLEstimation : OptimizationEstimation< CauchyDistribution*, CauchyDistribution, ContinuousUnivariateDistributionEstimation >
+    {
+        CauchyDistributionMLEstimation();
+        CauchyDistributionMLEstimation(CauchyDistribution const * estimated, UnivariateData const * data);
+        CauchyDistributionMLEstimation(const CauchyDistributionMLEstimation& estimation);
+        virtual ~CauchyDistributionMLEstimation();
+
+        /** \brief Maximum likelihood estimator of the Cauchy distribution parameters \f$\mu\f$ and \f$\sigma\f$.
+         *
+         * \details Starting from the median and the half interquartile range, Newton iterations are performed on \f$\left(\mu, \log \sigma\right)\f$.
+         *          The score and the Hessian are accumulated in a single pass over the observations and each step is halved until the log-likelihood increases.
+         *          If the Hessian is not negative definite, a scaled gradient step is used instead.
+         * */
+        class STATISKIT_CORE_API Estimator : public OptimizationEstimation< CauchyDistribution*, CauchyDistribution, ContinuousUnivariateDistributionEstimation >::Estimator
+        {
+            public:
+                Estimator();
+                Estimator(const Estimator& estimator);
+                virtual ~Estimator();
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
+        };
+    };
+
+    struct STATISKIT_CORE_API GumbelMaxDistributionMLEstimation : OptimizationEstimation< GumbelMaxDistribution*, GumbelMaxDistribution, ContinuousUnivariateDistributionEstimation >
+    {
+        GumbelMaxDistributionMLEstimation();
+        GumbelMaxDistributionMLEstimation(GumbelMaxDistribution const * estimated, UnivariateData const * data);
+        GumbelMaxDistributionMLEstimation(const GumbelMaxDistributionMLEstimation& estimation);
+        virtual ~GumbelMaxDistributionMLEstimation();
+
+        /** \brief Maximum likelihood estimator of the Gumbel max distribution parameters \f$\mu\f$ and \f$\sigma\f$.
+         *
+         * \details Starting from the moment estimates, Newton iterations are performed on \f$\left(\mu, \log \sigma\right)\f$.
+         *          The score and the Hessian are accumulated in a single pass over the observations and each step is halved until the log-likelihood increases.
+         *          If the Hessian is not negative definite, a scaled gradient step is used instead.
+         * */
+        class STATISKIT_CORE_API Estimator : public OptimizationEstimation< GumbelMaxDistribution*, GumbelMaxDistribution, ContinuousUnivariateDistributionEstimation >::Estimator
+        {
+            public:
+                Estimator();
+                Estimator(const Estimator& estimator);
+                virtual ~Estimator();
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
+        };
+    };
+
+    struct STATISKIT_CORE_API GumbelMinDistributionMLEstimation : OptimizationEstimation< GumbelMinDistribution*, GumbelMinDistribution, ContinuousUnivariateDistributionEstimation >
+    {
+        GumbelMinDistributionMLEstimation();
+        GumbelMinDistributionMLEstimation(GumbelMinDistribution const * estimated, UnivariateData const * data);
+        GumbelMinDistributionMLEstimation(const GumbelMinDistributionMLEstimation& estimation);
+        virtual ~GumbelMinDistributionMLEstimation();
+
+        /** \brief Maximum likelihood estimator of the Gumbel min distribution parameters \f$\mu\f$ and \f$\sigma\f$.
+         *
+         * \details Starting from the moment estimates, Newton iterations are performed on \f$\left(\mu, \log \sigma\right)\f$.
+         *          The score and the Hessian are accumulated in a single pass over the observations and each step is halved until the log-likelihood increases.
+         *          If the Hessian is not negative definite, a scaled gradient step is used instead.
+         * */
+        class STATISKIT_CORE_API Estimator : public OptimizationEstimation< GumbelMinDistribution*, GumbelMinDistribution, ContinuousUnivariateDistributionEstimation >::Estimator
+        {
+            public:
+                Estimator();
+                Estimator(const Estimator& estimator);
+                virtual ~Estimator();
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
+        };
+    };
+
+    struct STATISKIT_CORE_API NonStandardStudentDistributionMLEstimation : OptimizationEstimation< NonStandardStudentDistribution*, NonStandardStudentDistribution, ContinuousUnivariateDistributionEstimation >
+    {
+        NonStandardStudentDistributionMLEstimation();
+        NonStandardStudentDistributionMLEstimation(NonStandardStudentDistribution const * estimated, UnivariateData const * data);
+        NonStandardStudentDistributionMLEstimation(const NonStandardStudentDistributionMLEstimation& estimation);
+        virtual ~NonStandardStudentDistributionMLEstimation();
+
+        /** \brief Maximum likelihood estimator of the non-standard Student distribution parameters \f$\mu\f$, \f$\sigma\f$ and \f$\nu\f$.
+         *
+         * \details The ECME algorithm is used.
+         *          Given the current parameters, the expectation of latent precision weights \f$u_i = \frac{\nu + 1}{\nu + z_i^2}\f$ gives the weighted updates of \f$\mu\f$ and \f$\sigma\f$.
+         *          \f$\nu\f$ is then updated by maximizing the observed log-likelihood, its score being solved in \f$\log \nu\f$ with a bracketing method.
+         * */
+        class STATISKIT_CORE_API Estimator : public OptimizationEstimation< NonStandardStudentDistribution*, NonStandardStudentDistribution, ContinuousUnivariateDistributionEstimation >::Estimator
+        {
+            public:
+                Estimator();
+                Estimator(const Estimator& estimator);
+                virtual ~Estimator();
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
+
+                virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
+        };
+    };
+
     struct STATISKIT_CORE_API UnivariateHistogramDistributionEstimation : ActiveEstimation< UnivariateHistogramDistribution, ContinuousUnivariateDistributionEstimation >
     {
         UnivariateHistogramDistributionEstimation();
@@ -274,6 +444,12 @@ namespace statiskit
         };
     };
 
+    typedef SlopeHeuristicSelection< DiscreteUnivariateDistributionEstimation > DiscreteUnivariateDistributionSlopeHeuristicSelection;
+    typedef DiscreteUnivariateDistributionSlopeHeuristicSelection::Estimator DiscreteUnivariateDistributionSlopeHeuristicEstimator;
+
+    typedef SlopeHeuristicSelection< ContinuousUnivariateDistributionEstimation > ContinuousUnivariateDistributionSlopeHeuristicSelection;
+    typedef ContinuousUnivariateDistributionSlopeHeuristicSelection::Estimator ContinuousUnivariateDistributionSlopeHeuristicEstimator;
+
     struct STATISKIT_CORE_API RegularUnivariateHistogramDistributionSlopeHeuristicSelection : SlopeHeuristicSelection< ContinuousUnivariateDistributionEstimation >
     {
         RegularUnivariateHistogramDistributionSlopeHeuristicSelection(const UnivariateData* data);
@@ -301,31 +477,40 @@ namespace statiskit
 
     struct STATISKIT_CORE_API IrregularUnivariateHistogramDistributionSlopeHeuristicSelection : SlopeHeuristicSelection< ContinuousUnivariateDistributionEstimation >
     {
-        IrregularUnivariateHistogramDistributionSlopeHeuristicSelection(const UnivariateData* data);
-        IrregularUnivariateHistogramDistributionSlopeHeuristicSelection(const IrregularUnivariateHistogramDistributionSlopeHeuristicSelection& selection);
-        virtual ~IrregularUnivariateHistogramDistributionSlopeHeuristicSelection();
+        public:
+            IrregularUnivariateHistogramDistributionSlopeHeuristicSelection(const UnivariateData* data);
+            IrregularUnivariateHistogramDistributionSlopeHeuristicSelection(const IrregularUnivariateHistogramDistributionSlopeHeuristicSelection& selection);
+            virtual ~IrregularUnivariateHistogramDistributionSlopeHeuristicSelection();
 
-        class STATISKIT_CORE_API Estimator : public ContinuousUnivariateDistributionEstimation::Estimator
-        {
-            public:
-                Estimator();
-                Estimator(const Estimator& estimator);
-                virtual ~Estimator();
+            virtual const UnivariateDistribution* get_proposal(const Index& index) const;
 
-                virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
+            class STATISKIT_CORE_API Estimator : public ContinuousUnivariateDistributionEstimation::Estimator
+            {
+                public:
+                    Estimator();
+                    Estimator(const Estimator& estimator);
+                    virtual ~Estimator();
 
-                virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
+                    virtual std::unique_ptr< UnivariateDistributionEstimation > operator() (const UnivariateData& data, const bool& lazy=true) const;
 
-                const unsigned int& get_maxbins() const;
-                void set_maxbins(const unsigned int& maxbins);
+                    virtual std::unique_ptr< UnivariateDistributionEstimation::Estimator > copy() const;
 
-                const double& get_constant() const;
-                void set_constant(const double& constant);
+                    const unsigned int& get_maxbins() const;
+                    void set_maxbins(const unsigned int& maxbins);
 
-            protected:
-                unsigned int _maxbins;
-                double _constant;
-        }; 
+                    const double& get_constant() const;
+                    void set_constant(const double& constant);
+
+                protected:
+                    unsigned int _maxbins;
+                    double _constant;
+            }; 
+
+        protected:
+            std::vector< double > _bins;
+            std::vector< double > _densities;
+            std::vector< Index > _merges;
+            std::vector< Index > _steps;
     };
 
     class STATISKIT_CORE_API MultinomialSplittingDistributionEstimation : public ActiveEstimation< MultinomialSplittingDistribution, DiscreteMultivariateDistributionEstimation >
@@ -352,13 +537,22 @@ namespace statiskit
                     const DiscreteUnivariateDistributionEstimation::Estimator* get_sum() const;
                     void set_sum(const DiscreteUnivariateDistributionEstimation::Estimator& sum);
 
+                    bool get_compress() const;
+                    void set_compress(const bool& compress);
+
                 protected:
                     DiscreteUnivariateDistributionEstimation::Estimator* _sum;
+                    bool _compress;
 
+                    /** Sum of the components of multivariate data
+                     *
+                     * Row sums are materialized in a single pass over the multivariate data, together with the weighted totals of each component.
+                     * If compressed, equal sums are merged into one event weighted by the total weight of the corresponding rows.
+                     */
                     class STATISKIT_CORE_API SumData : public UnivariateData
                     {
                         public:
-                            SumData(const MultivariateData* data);
+                            SumData(const MultivariateData& data, const bool& compress);
                             virtual ~SumData();
 
                             virtual std::unique_ptr< UnivariateData::Generator > generator() const;
@@ -367,13 +561,17 @@ namespace statiskit
 
                             virtual std::unique_ptr< UnivariateData > copy() const;
 
+                            const Eigen::VectorXd& get_pi() const;
+
                         protected:
-                            const MultivariateData* _data;
+                            std::vector< DiscreteElementaryEvent > _events;
+                            std::vector< double > _weights;
+                            Eigen::VectorXd _pi;
 
                             class STATISKIT_CORE_API Generator : public UnivariateData::Generator
                             {
                                 public:
-                                    Generator(const MultivariateData* data);
+                                    Generator(const SumData* data);
                                     virtual ~Generator();
 
                                     virtual bool is_valid() const;
@@ -384,8 +582,8 @@ namespace statiskit
                                     virtual double weight() const;
 
                                 protected:
-                                    mutable DiscreteElementaryEvent* _sum;
-                                    MultivariateData::Generator* _generator;
+                                    const SumData* _data;
+                                    Index _index;
                             };
 
                     };
@@ -402,6 +600,11 @@ namespace statiskit
             DiscreteUnivariateDistributionEstimation* _sum;
     };
 
+    /** Estimation of a multivariate distribution with independent components
+     *
+     * Each component is fitted with its own estimator (or the default one) on the corresponding marginal data.
+     * These fits are independent and are therefore dispatched on the available threads, their results being gathered in the order of components.
+     */
     template<class D, class E> class IndependentMultivariateDistributionEstimation : public ActiveEstimation< IndependentMultivariateDistribution< D >, E >
     {
         public:
@@ -425,15 +628,15 @@ namespace statiskit
                     
                     virtual std::unique_ptr< MultivariateDistributionEstimation::Estimator > copy() const;
 
-                    const typename E::Estimator::marginal_type* get_default_estimator() const;
-                    void set_default_estimator(const typename E::Estimator::marginal_type& estimator);
+                    const typename E::marginal_type::Estimator* get_default_estimator() const;
+                    void set_default_estimator(const typename E::marginal_type::Estimator& estimator);
 
-                    const typename E::Estimator::marginal_type* get_estimator(const Index& index) const;
-                    void set_estimator(const Index& index, const typename E::Estimator::marginal_type* estimator);
+                    const typename E::marginal_type::Estimator* get_estimator(const Index& index) const;
+                    void set_estimator(const Index& index, const typename E::marginal_type::Estimator* estimator);
 
                 protected:
-                    typename E::Estimator::marginal_type* _default_estimator;
-                    std::map< Index, typename E::Estimator::marginal_type* > _estimators;
+                    typename E::marginal_type::Estimator* _default_estimator;
+                    std::map< Index, typename E::marginal_type::Estimator* > _estimators;
             };
 
         protected:
@@ -480,9 +683,84 @@ namespace statiskit
                 D* _initializator;
                 typename E::Estimator* _default_estimator;
                 std::map< Index, typename E::Estimator* > _estimators;
+
+                virtual std::unique_ptr< typename E::Estimator::estimation_type > create(D* mixture, const typename E::Estimator::estimation_type::data_type& data, const bool& lazy) const;
+                virtual Eigen::VectorXd expectation(const D& mixture, const typename D::data_type::event_type* event) const;
+                virtual double criterion(const D& mixture, const typename E::Estimator::estimation_type::data_type& data) const;
+        };
+    };
+
+    /** Classification expectation-maximization (CEM) estimation of mixture distributions
+     *
+     * Each event is assigned to its most probable state and the components are refitted on these hard partitions.
+     * Iterations stop when the classification log-likelihood no longer increases.
+     * A state to which no event is assigned raises a parameter error instead of being silently kept.
+     * The estimated mixture is a cheap starting point for \ref ::statiskit::MixtureDistributionEMEstimation::Estimator::set_initializator.
+     */
+    template<class D, class E> struct MixtureDistributionCEMEstimation : MixtureDistributionEMEstimation< D, E >
+    {
+        MixtureDistributionCEMEstimation();
+        MixtureDistributionCEMEstimation(D const * estimated, typename E::data_type const * data);
+        MixtureDistributionCEMEstimation(const MixtureDistributionCEMEstimation< D, E >& estimation);
+        virtual ~MixtureDistributionCEMEstimation();
+
+        class Estimator : public MixtureDistributionEMEstimation< D, E >::Estimator
+        {
+            public:
+                Estimator();
+                Estimator(const Estimator& estimator);
+                virtual ~Estimator();
+
+                virtual std::unique_ptr< typename E::Estimator::estimation_type::Estimator > copy() const;
+
+            protected:
+                virtual std::unique_ptr< typename E::Estimator::estimation_type > create(D* mixture, const typename E::Estimator::estimation_type::data_type& data, const bool& lazy) const;
+                virtual Eigen::VectorXd expectation(const D& mixture, const typename D::data_type::event_type* event) const;
+                virtual double criterion(const D& mixture, const typename E::Estimator::estimation_type::data_type& data) const;
         };
     };
     
+    /** Selection of the number of components of a mixture distribution
+     *
+     * The EM algorithm is run from the initializator and the components with a weight inferior to the threshold are then removed (or the lightest one if none).
+     * The remaining components are used to warm-start the EM algorithm on the smaller mixture until only one component remains.
+     * Each fitted mixture is scored with the BIC or the ICL, the latter subtracting the classification entropy computed with \ref ::statiskit::MixtureDistribution::uncertainty.
+     */
+    template<class D, class E> struct MixtureDistributionEMSelection : Selection< D, E >
+    {
+        MixtureDistributionEMSelection();
+        MixtureDistributionEMSelection(typename E::data_type const * data);
+        MixtureDistributionEMSelection(const MixtureDistributionEMSelection< D, E >& selection);
+        virtual ~MixtureDistributionEMSelection();
+
+        class Estimator : public MixtureDistributionEMEstimation< D, E >::Estimator
+        {
+            public:
+                enum criterion_type {
+                    BIC,
+                    ICL
+                };
+
+                Estimator();
+                Estimator(const Estimator& estimator);
+                virtual ~Estimator();
+
+                virtual std::unique_ptr< typename E::Estimator::estimation_type > operator() (const typename E::Estimator::estimation_type::data_type& data, const bool& lazy=true) const;
+
+                virtual std::unique_ptr< typename E::Estimator::estimation_type::Estimator > copy() const;
+
+                const criterion_type& get_criterion() const;
+                void set_criterion(const criterion_type& criterion);
+
+                const double& get_threshold() const;
+                void set_threshold(const double& threshold);
+
+            protected:
+                criterion_type _criterion;
+                double _threshold;
+        };
+    };
+
     typedef MixtureDistributionEMEstimation< CategoricalUnivariateMixtureDistribution, CategoricalUnivariateDistributionEstimation > CategoricalUnivariateMixtureDistributionEMEstimation;
     typedef CategoricalUnivariateMixtureDistributionEMEstimation::Estimator CategoricalUnivariateMixtureDistributionEMEstimator;
 
@@ -503,6 +781,48 @@ namespace statiskit
 
     typedef MixtureDistributionEMEstimation< ContinuousMultivariateMixtureDistribution, ContinuousMultivariateDistributionEstimation > ContinuousMultivariateMixtureDistributionEMEstimation;
     typedef ContinuousMultivariateMixtureDistributionEMEstimation::Estimator ContinuousMultivariateMixtureDistributionEMEstimator;
+
+    typedef MixtureDistributionCEMEstimation< CategoricalUnivariateMixtureDistribution, CategoricalUnivariateDistributionEstimation > CategoricalUnivariateMixtureDistributionCEMEstimation;
+    typedef CategoricalUnivariateMixtureDistributionCEMEstimation::Estimator CategoricalUnivariateMixtureDistributionCEMEstimator;
+
+    typedef MixtureDistributionCEMEstimation< DiscreteUnivariateMixtureDistribution, DiscreteUnivariateDistributionEstimation > DiscreteUnivariateMixtureDistributionCEMEstimation;
+    typedef DiscreteUnivariateMixtureDistributionCEMEstimation::Estimator DiscreteUnivariateMixtureDistributionCEMEstimator;
+
+    typedef MixtureDistributionCEMEstimation< ContinuousUnivariateMixtureDistribution, ContinuousUnivariateDistributionEstimation > ContinuousUnivariateMixtureDistributionCEMEstimation;
+    typedef ContinuousUnivariateMixtureDistributionCEMEstimation::Estimator ContinuousUnivariateMixtureDistributionCEMEstimator;
+
+    typedef MixtureDistributionCEMEstimation< MixedMultivariateMixtureDistribution, MultivariateDistributionEstimation > MixedMultivariateMixtureDistributionCEMEstimation;
+    typedef MixedMultivariateMixtureDistributionCEMEstimation::Estimator MixedMultivariateMixtureDistributionCEMEstimator;
+
+    typedef MixtureDistributionCEMEstimation< CategoricalMultivariateMixtureDistribution, CategoricalMultivariateDistributionEstimation > CategoricalMultivariateMixtureDistributionCEMEstimation;
+    typedef CategoricalMultivariateMixtureDistributionCEMEstimation::Estimator CategoricalMultivariateMixtureDistributionCEMEstimator;
+
+    typedef MixtureDistributionCEMEstimation< DiscreteMultivariateMixtureDistribution, DiscreteMultivariateDistributionEstimation > DiscreteMultivariateMixtureDistributionCEMEstimation;
+    typedef DiscreteMultivariateMixtureDistributionCEMEstimation::Estimator DiscreteMultivariateMixtureDistributionCEMEstimator;
+
+    typedef MixtureDistributionCEMEstimation< ContinuousMultivariateMixtureDistribution, ContinuousMultivariateDistributionEstimation > ContinuousMultivariateMixtureDistributionCEMEstimation;
+    typedef ContinuousMultivariateMixtureDistributionCEMEstimation::Estimator ContinuousMultivariateMixtureDistributionCEMEstimator;
+
+    typedef MixtureDistributionEMSelection< CategoricalUnivariateMixtureDistribution, CategoricalUnivariateDistributionEstimation > CategoricalUnivariateMixtureDistributionEMSelection;
+    typedef CategoricalUnivariateMixtureDistributionEMSelection::Estimator CategoricalUnivariateMixtureDistributionEMSelectionEstimator;
+
+    typedef MixtureDistributionEMSelection< DiscreteUnivariateMixtureDistribution, DiscreteUnivariateDistributionEstimation > DiscreteUnivariateMixtureDistributionEMSelection;
+    typedef DiscreteUnivariateMixtureDistributionEMSelection::Estimator DiscreteUnivariateMixtureDistributionEMSelectionEstimator;
+
+    typedef MixtureDistributionEMSelection< ContinuousUnivariateMixtureDistribution, ContinuousUnivariateDistributionEstimation > ContinuousUnivariateMixtureDistributionEMSelection;
+    typedef ContinuousUnivariateMixtureDistributionEMSelection::Estimator ContinuousUnivariateMixtureDistributionEMSelectionEstimator;
+
+    typedef MixtureDistributionEMSelection< MixedMultivariateMixtureDistribution, MultivariateDistributionEstimation > MixedMultivariateMixtureDistributionEMSelection;
+    typedef MixedMultivariateMixtureDistributionEMSelection::Estimator MixedMultivariateMixtureDistributionEMSelectionEstimator;
+
+    typedef MixtureDistributionEMSelection< CategoricalMultivariateMixtureDistribution, CategoricalMultivariateDistributionEstimation > CategoricalMultivariateMixtureDistributionEMSelection;
+    typedef CategoricalMultivariateMixtureDistributionEMSelection::Estimator CategoricalMultivariateMixtureDistributionEMSelectionEstimator;
+
+    typedef MixtureDistributionEMSelection< DiscreteMultivariateMixtureDistribution, DiscreteMultivariateDistributionEstimation > DiscreteMultivariateMixtureDistributionEMSelection;
+    typedef DiscreteMultivariateMixtureDistributionEMSelection::Estimator DiscreteMultivariateMixtureDistributionEMSelectionEstimator;
+
+    typedef MixtureDistributionEMSelection< ContinuousMultivariateMixtureDistribution, ContinuousMultivariateDistributionEstimation > ContinuousMultivariateMixtureDistributionEMSelection;
+    typedef ContinuousMultivariateMixtureDistributionEMSelection::Estimator ContinuousMultivariateMixtureDistributionEMSelectionEstimator;
 }
 
 #include "estimator.hpp"
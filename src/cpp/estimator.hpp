@@ -111,7 +111,14 @@ namespace statiskit
 
     template<class D, class E>
         IndependentMultivariateDistributionEstimation< D, E >::~IndependentMultivariateDistributionEstimation()
-        {}
+        {
+            for(Index component = 0, max_component = _estimations.size(); component < max_component; ++component)
+            {
+                delete _estimations[component];
+                _estimations[component] = nullptr;
+            }
+            _estimations.clear();
+        }
 
     template<class D, class E>
         Index IndependentMultivariateDistributionEstimation< D, E >::size() const 
@@ -135,17 +142,20 @@ namespace statiskit
     template<class D, class E>
         IndependentMultivariateDistributionEstimation< D, E >::Estimator::Estimator(const Estimator& estimator) 
         {
-            _default_estimator = static_cast< typename E::Estimator::marginal_type* >(estimator._default_estimator->copy().release());
+            if(estimator._default_estimator)
+            { _default_estimator = static_cast< typename E::marginal_type::Estimator* >(estimator._default_estimator->copy().release()); }
+            else
+            { _default_estimator = nullptr; }
             _estimators.clear();
-            for(typename std::map< Index, typename E::Estimator::marginal_type* >::const_iterator it = estimator._estimators.cbegin(), it_end = estimator._estimators.cend(); it != it_end; ++it)            
-            { _estimators[it->first] = it->second->copy().release(); }
+            for(typename std::map< Index, typename E::marginal_type::Estimator* >::const_iterator it = estimator._estimators.cbegin(), it_end = estimator._estimators.cend(); it != it_end; ++it)            
+            { _estimators[it->first] = static_cast< typename E::marginal_type::Estimator* >(it->second->copy().release()); }
         }
 
     template<class D, class E>
         IndependentMultivariateDistributionEstimation< D, E >::Estimator::~Estimator() 
         {
             delete _default_estimator;
-            for(typename std::map< Index, typename E::Estimator::marginal_type* >::iterator it = _estimators.begin(), it_end = _estimators.end(); it != it_end; ++it)            
+            for(typename std::map< Index, typename E::marginal_type::Estimator* >::iterator it = _estimators.begin(), it_end = _estimators.end(); it != it_end; ++it)            
             {
                 delete it->second;
                 it->second = nullptr;
@@ -157,36 +167,38 @@ namespace statiskit
         std::unique_ptr< MultivariateDistributionEstimation > IndependentMultivariateDistributionEstimation< D, E >::Estimator::operator() (const MultivariateData& data, const bool& lazy) const 
         { 
             std::unique_ptr< MultivariateDistributionEstimation > estimation;
-            typename std::map< Index, typename E::Estimator::marginal_type* >::const_iterator it = _estimators.cbegin(), it_end = _estimators.cend();
-            typename E::Estimator::marginal_type* estimator;
-            std::vector< UnivariateDistributionEstimation* > estimations(data.get_sample_space()->size(), nullptr);
-            for(Index component = 0, max_component = estimations.size(); component < max_component; ++component)
+            typename std::map< Index, typename E::marginal_type::Estimator* >::const_iterator it = _estimators.cbegin(), it_end = _estimators.cend();
+            std::vector< typename E::marginal_type::Estimator const * > estimators(data.get_sample_space()->size(), nullptr);
+            for(Index component = 0, max_component = estimators.size(); component < max_component; ++component)
             {
                 while(it != it_end && it->first < component)
                 { ++it; }
                 if(it != it_end && it->first == component)
-                { estimator = it->second; }
+                { estimators[component] = it->second; }
                 else
-                { estimator = _default_estimator; }
-                estimations[component] = (*estimator)(*(data.extract(component).get()), lazy).release();
+                { estimators[component] = _default_estimator; }
+                if(!estimators[component])
+                { throw member_error("default_estimator", "you must give a default estimator or an estimator for component " + __impl::to_string(component)); }
             }
-            std::vector< typename D::marginal_type > distributions(estimations.size());
+            std::vector< std::unique_ptr< UnivariateDistributionEstimation > > estimations(estimators.size());
+            __impl::parallel_for(estimations.size(), [&data, &lazy, &estimators, &estimations](const Index& component)
+            { estimations[component] = (*estimators[component])(*(data.extract(component).get()), lazy); });
+            std::vector< typename D::marginal_type const * > marginals(estimations.size(), nullptr);
             for(Index component = 0, max_component = estimations.size(); component < max_component; ++component)
-            { distributions[component] = *static_cast< typename D::marginal_type* >(estimations[component]->get_estimated()); }
-            IndependentMultivariateDistribution< D > * distribution = new IndependentMultivariateDistribution< D >(distributions);
-            if(lazy)
             {
-                estimation = std::make_unique< LazyEstimation< IndependentMultivariateDistribution< D >, E > >(distribution);
-                for(Index component = 0, max_component = estimations.size(); component < max_component; ++component)
-                {
-                    delete estimations[component];
-                    estimations[component] = nullptr;
-                }
+                if(!estimations[component])
+                { throw member_error("estimator", "the estimation of component " + __impl::to_string(component) + " failed"); }
+                marginals[component] = static_cast< typename D::marginal_type const * >(estimations[component]->get_estimated());
             }
+            IndependentMultivariateDistribution< D > * distribution = new IndependentMultivariateDistribution< D >(marginals);
+            if(lazy)
+            { estimation = std::make_unique< LazyEstimation< IndependentMultivariateDistribution< D >, E > >(distribution); }
             else
             {
                 IndependentMultivariateDistributionEstimation< D, E >* _estimation =  new IndependentMultivariateDistributionEstimation< D, E >(distribution, &data);
-                _estimation->_estimations = estimations;
+                _estimation->_estimations.resize(estimations.size(), nullptr);
+                for(Index component = 0, max_component = estimations.size(); component < max_component; ++component)
+                { _estimation->_estimations[component] = estimations[component].release(); }
                 estimation.reset(_estimation);
             }
             return estimation;
@@ -197,21 +209,21 @@ namespace statiskit
         { return std::make_unique< Estimator >(*this); }
 
     template<class D, class E>
-        const typename E::Estimator::marginal_type* IndependentMultivariateDistributionEstimation< D, E >::Estimator::get_default_estimator() const
+        const typename E::marginal_type::Estimator* IndependentMultivariateDistributionEstimation< D, E >::Estimator::get_default_estimator() const
         { return _default_estimator; }
 
     template<class D, class E>
-        void IndependentMultivariateDistributionEstimation< D, E >::Estimator::set_default_estimator(const typename E::Estimator::marginal_type& estimator)
+        void IndependentMultivariateDistributionEstimation< D, E >::Estimator::set_default_estimator(const typename E::marginal_type::Estimator& estimator)
         { 
             delete _default_estimator;
-            _default_estimator = static_cast< typename E::Estimator::marginal_type* >(estimator.copy().release());
+            _default_estimator = static_cast< typename E::marginal_type::Estimator* >(estimator.copy().release());
         }
 
     template<class D, class E>
-        const typename E::Estimator::marginal_type* IndependentMultivariateDistributionEstimation< D, E >::Estimator::get_estimator(const Index& index) const
+        const typename E::marginal_type::Estimator* IndependentMultivariateDistributionEstimation< D, E >::Estimator::get_estimator(const Index& index) const
         { 
-            typename std::map< Index, typename E::Estimator::marginal_type* >::const_iterator it = _estimators.find(index);
-            typename E::Estimator::marginal_type* estimator;
+            typename std::map< Index, typename E::marginal_type::Estimator* >::const_iterator it = _estimators.find(index);
+            typename E::marginal_type::Estimator* estimator;
             if(it == _estimators.cend())
             { estimator = _default_estimator; }
             else
@@ -220,17 +232,17 @@ namespace statiskit
         }
 
     template<class D, class E>
-        void IndependentMultivariateDistributionEstimation< D, E >::Estimator::set_estimator(const Index& index, const typename E::Estimator::marginal_type* estimator)
+        void IndependentMultivariateDistributionEstimation< D, E >::Estimator::set_estimator(const Index& index, const typename E::marginal_type::Estimator* estimator)
         { 
-            typename std::map< Index, typename E::Estimator::marginal_type* >::const_iterator it = _estimators.find(index);
+            typename std::map< Index, typename E::marginal_type::Estimator* >::iterator it = _estimators.find(index);
             if(it == _estimators.end() && estimator)
-            { _estimators[index] = static_cast< typename E::Estimator::marginal_type* >(estimator->copy().release()); }
+            { _estimators[index] = static_cast< typename E::marginal_type::Estimator* >(estimator->copy().release()); }
             else if(estimator)
             { 
                 delete it->second;
-                it->second = static_cast< typename E::Estimator::marginal_type* >(estimator->copy().release());
+                it->second = static_cast< typename E::marginal_type::Estimator* >(estimator->copy().release());
             }
-            else
+            else if(it != _estimators.end())
             {
                 delete it->second;
                 _estimators.erase(it);
@@ -265,9 +277,15 @@ namespace statiskit
     template<class D, class E>
         MixtureDistributionEMEstimation< D, E >::Estimator::Estimator(const Estimator& estimator) : OptimizationEstimation< D*, D, E >::Estimator(estimator)
         {
-            _pi = true;
-            _initializator = static_cast< D* >(estimator._initializator->copy().release());
-            _default_estimator = static_cast< typename E::Estimator* >(estimator._default_estimator->copy().release());
+            _pi = estimator._pi;
+            if(estimator._initializator)
+            { _initializator = static_cast< D* >(estimator._initializator->copy().release()); }
+            else
+            { _initializator = nullptr; }
+            if(estimator._default_estimator)
+            { _default_estimator = static_cast< typename E::Estimator* >(estimator._default_estimator->copy().release()); }
+            else
+            { _default_estimator = nullptr; }
             _estimators.clear();
             for(typename std::map< Index, typename E::Estimator* >::const_iterator it = estimator._estimators.cbegin(), it_end = estimator._estimators.cend(); it != it_end; ++it)            
             { _estimators[it->first] = static_cast< typename E::Estimator* >(it->second->copy().release()); }
@@ -293,56 +311,90 @@ namespace statiskit
             { throw member_error("initializator", "you must give an initial mixture distribution in order to initialize the expectation-maximization algorithm"); }
             D* mixture = static_cast< D* >(_initializator->copy().release());
             typename E::Estimator::estimation_type::data_type::weighted_type weighted = typename E::Estimator::estimation_type::data_type::weighted_type(&data);
-            double prev, curr = mixture->loglikelihood(data);
+            double prev, curr = criterion(*mixture, data);
             unsigned int its = 0;
-            std::unique_ptr< typename E::Estimator::estimation_type > estimation;
+            std::unique_ptr< typename E::Estimator::estimation_type > estimation = create(mixture, data, lazy);
             if(!lazy)
-            {
-                estimation = std::make_unique< MixtureDistributionEMEstimation< D, E > >(mixture, &data);
-                static_cast< MixtureDistributionEMEstimation< D, E >* >(estimation.get())->_iterations.push_back(static_cast< D* >(mixture->copy().release()));
-            }
-            else
-            { estimation = std::make_unique< LazyEstimation< D, MixtureDistributionEMEstimation< D, E > > >(mixture); }
+            { static_cast< MixtureDistributionEMEstimation< D, E >* >(estimation.get())->_iterations.push_back(static_cast< D* >(mixture->copy().release())); }
             do
             {
                 prev = curr;
-                Eigen::VectorXd pi = mixture->get_pi();
-                std::vector< typename E::Estimator::estimation_type* > estimations(mixture->get_nb_states(), nullptr);
+                Eigen::VectorXd pi = Eigen::VectorXd::Zero(mixture->get_nb_states());
+                std::vector< std::unique_ptr< typename E::Estimator::statistic_type > > statistics(mixture->get_nb_states());
+                bool sufficient = true;
                 for(Index state = 0, max_state = mixture->get_nb_states(); state < max_state; ++state)
                 {
-                    const typename D::observation_type* observation = mixture->get_observation(state);
-                    typename E::Estimator::estimation_type::data_type::weighted_type::Generator* generator = static_cast< typename E::Estimator::estimation_type::data_type::weighted_type::Generator* >(weighted.generator().release());
-                    Index index = 0;
-                    while(generator->is_valid())
+                    const typename E::Estimator* estimator = get_estimator(state);
+                    if(estimator)
                     {
-                        generator->weight(mixture->posterior(generator->event())[state]);
-                        ++(*generator);
-
+                        statistics[state] = estimator->statistic();
+                        sufficient = sufficient && statistics[state];
+                    }
+                }
+                std::vector< Eigen::VectorXd > posteriors;
+                std::unique_ptr< typename E::Estimator::estimation_type::data_type::Generator > generator = data.generator();
+                while(generator->is_valid())
+                {
+                    Eigen::VectorXd posterior = generator->weight() * expectation(*mixture, generator->event());
+                    pi += posterior;
+                    if(sufficient)
+                    {
+                        for(Index state = 0, max_state = mixture->get_nb_states(); state < max_state; ++state)
+                        {
+                            if(statistics[state])
+                            { statistics[state]->update(generator->event(), posterior[state]); }
+                        }
                     }
+                    else
+                    { posteriors.push_back(posterior); }
+                    ++(*generator);
+                }
+                for(Index state = 0, max_state = mixture->get_nb_states(); state < max_state; ++state)
+                {
+                    if(!(pi[state] > 0.))
+                    { throw parameter_error("data", "no event is assigned to state " + __impl::to_string(state)); }
+                }
+                std::vector< typename E::Estimator::estimation_type* > estimations(mixture->get_nb_states(), nullptr);
+                for(Index state = 0, max_state = mixture->get_nb_states(); state < max_state; ++state)
+                {
                     const typename E::Estimator* estimator = get_estimator(state);
                     if(estimator)
                     {
+                        if(!sufficient)
+                        {
+                            std::unique_ptr< typename E::Estimator::estimation_type::data_type::Generator > _generator = weighted.generator();
+                            Index index = 0;
+                            while(_generator->is_valid())
+                            {
+                                static_cast< typename E::Estimator::estimation_type::data_type::weighted_type::Generator* >(_generator.get())->weight(posteriors[index][state]);
+                                ++index;
+                                ++(*_generator);
+                            }
+                        }
                         try
-                        { estimations[state] = (*estimator)(weighted, true).release(); }
+                        {
+                            if(sufficient)
+                            { estimations[state] = static_cast< const typename E::Estimator::estimation_type::Estimator& >(*estimator)(*(statistics[state])).release(); }
+                            else
+                            { estimations[state] = (*estimator)(weighted, true).release(); }
+                        }
                         catch(const std::exception& exception)
                         { estimations[state] = nullptr; }
                     }
-                    else
-                    { estimations[state] = nullptr; }
-                    pi[state] = weighted.compute_total();
                 }
                 for(Index state = 0, max_state = mixture->get_nb_states(); state < max_state; ++state)
                 {
                     if(estimations[state])
                     {
-                        mixture->set_observation(state, *(static_cast< const typename D::observation_type* >(estimations[state]->get_estimated())));
+                        if(estimations[state]->get_estimated())
+                        { mixture->set_observation(state, *(static_cast< const typename D::observation_type* >(estimations[state]->get_estimated()))); }
                         delete estimations[state];
                     }
                 }
                 pi = pi / pi.sum();
                 if(_pi)
                 { mixture->set_pi(pi); }
-                curr = mixture->loglikelihood(data);
+                curr = criterion(*mixture, data);
                 if(!lazy)
                 { static_cast< MixtureDistributionEMEstimation< D, E >* >(estimation.get())->_iterations.push_back(static_cast< D* >(mixture->copy().release())); }
                 ++its;
@@ -399,7 +451,7 @@ namespace statiskit
                 delete it->second;
                 it->second = static_cast< typename E::Estimator* >(estimator->copy().release());
             }
-            else
+            else if(it != _estimators.end())
             {
                 delete it->second;
                 _estimators.erase(it);
@@ -413,7 +465,256 @@ namespace statiskit
 
     template<class D, class E>
         void MixtureDistributionEMEstimation< D, E >::Estimator::set_initializator(const D& initializator)
-        { _initializator = static_cast< D* >(initializator.copy().release()); }
+        {
+            delete _initializator;
+            _initializator = static_cast< D* >(initializator.copy().release());
+        }
+
+    template<class D, class E>
+        std::unique_ptr< typename E::Estimator::estimation_type > MixtureDistributionEMEstimation< D, E >::Estimator::create(D* mixture, const typename E::Estimator::estimation_type::data_type& data, const bool& lazy) const
+        {
+            std::unique_ptr< typename E::Estimator::estimation_type > estimation;
+            if(lazy)
+            { estimation = std::make_unique< LazyEstimation< D, MixtureDistributionEMEstimation< D, E > > >(mixture); }
+            else
+            { estimation = std::make_unique< MixtureDistributionEMEstimation< D, E > >(mixture, &data); }
+            return estimation;
+        }
+
+    template<class D, class E>
+        Eigen::VectorXd MixtureDistributionEMEstimation< D, E >::Estimator::expectation(const D& mixture, const typename D::data_type::event_type* event) const
+        { return mixture.posterior(event); }
+
+    template<class D, class E>
+        double MixtureDistributionEMEstimation< D, E >::Estimator::criterion(const D& mixture, const typename E::Estimator::estimation_type::data_type& data) const
+        { return mixture.loglikelihood(data); }
+
+    template<class D, class E>
+        MixtureDistributionEMSelection< D, E >::MixtureDistributionEMSelection() : Selection< D, E >()
+        {}
+
+    template<class D, class E>
+        MixtureDistributionEMSelection< D, E >::MixtureDistributionEMSelection(typename E::data_type const * data) : Selection< D, E >(data)
+        {}
+
+    template<class D, class E>
+        MixtureDistributionEMSelection< D, E >::MixtureDistributionEMSelection(const MixtureDistributionEMSelection< D, E >& selection) : Selection< D, E >(selection)
+        {}
+
+    template<class D, class E>
+        MixtureDistributionEMSelection< D, E >::~MixtureDistributionEMSelection()
+        {}
+
+    template<class D, class E>
+        MixtureDistributionEMSelection< D, E >::Estimator::Estimator() : MixtureDistributionEMEstimation< D, E >::Estimator()
+        {
+            _criterion = BIC;
+            _threshold = 1e-2;
+        }
+
+    template<class D, class E>
+        MixtureDistributionEMSelection< D, E >::Estimator::Estimator(const Estimator& estimator) : MixtureDistributionEMEstimation< D, E >::Estimator(estimator)
+        {
+            _criterion = estimator._criterion;
+            _threshold = estimator._threshold;
+        }
+
+    template<class D, class E>
+        MixtureDistributionEMSelection< D, E >::Estimator::~Estimator()
+        {}
+
+    template<class D, class E>
+        std::unique_ptr< typename E::Estimator::estimation_type > MixtureDistributionEMSelection< D, E >::Estimator::operator() (const typename E::Estimator::estimation_type::data_type& data, const bool& lazy) const
+        {
+            if(!this->_initializator)
+            { throw member_error("initializator", "you must give an initial mixture distribution with the maximal number of components"); }
+            MixtureDistributionEMSelection< D, E >* selection;
+            if(lazy)
+            { selection = new MixtureDistributionEMSelection< D, E >(nullptr); }
+            else
+            { selection = new MixtureDistributionEMSelection< D, E >(&data); }
+            typename MixtureDistributionEMEstimation< D, E >::Estimator estimator = typename MixtureDistributionEMEstimation< D, E >::Estimator(*this);
+            double total = data.compute_total();
+            D* mixture = static_cast< D* >(this->_initializator->copy().release());
+            std::vector< Index > origins(mixture->get_nb_states());
+            for(Index state = 0, max_state = origins.size(); state < max_state; ++state)
+            { origins[state] = state; }
+            while(mixture)
+            {
+                estimator.set_initializator(*mixture);
+                for(Index state = 0, max_state = origins.size(); state < max_state; ++state)
+                {
+                    typename std::map< Index, typename E::Estimator* >::const_iterator it = this->_estimators.find(origins[state]);
+                    if(it == this->_estimators.cend())
+                    { estimator.set_estimator(state, nullptr); }
+                    else
+                    { estimator.set_estimator(state, it->second); }
+                }
+                std::unique_ptr< typename E::Estimator::estimation_type > estimation;
+                try
+                { estimation = estimator(data, lazy); }
+                catch(const std::exception& e)
+                { estimation.reset(); }
+                const D* estimated;
+                double score;
+                if(estimation && estimation->get_estimated())
+                {
+                    estimated = static_cast< const D* >(estimation->get_estimated());
+                    score = estimated->loglikelihood(data) - estimated->get_nb_parameters() * log(total) / 2.;
+                    if(_criterion == ICL)
+                    { score -= estimated->uncertainty(data); }
+                }
+                else
+                {
+                    estimated = mixture;
+                    score = std::numeric_limits< double >::quiet_NaN();
+                }
+                selection->_estimations.push_back(static_cast< E* >(estimation.release()));
+                selection->_scores.push_back(score);
+                const Eigen::VectorXd& pi = estimated->get_pi();
+                D* next = nullptr;
+                if(pi.size() > 1)
+                {
+                    std::vector< Index > states;
+                    for(Index state = 0, max_state = pi.size(); state < max_state; ++state)
+                    {
+                        if(pi[state] >= _threshold)
+                        { states.push_back(state); }
+                    }
+                    if(states.size() == static_cast< std::size_t >(pi.size()))
+                    {
+                        Index state;
+                        pi.minCoeff(&state);
+                        states.erase(states.begin() + state);
+                    }
+                    else if(states.empty())
+                    {
+                        states.push_back(0);
+                        pi.maxCoeff(&states.back());
+                    }
+                    std::vector< typename D::observation_type* > observations(states.size());
+                    Eigen::VectorXd weights = Eigen::VectorXd(states.size());
+                    for(Index index = 0, max_index = states.size(); index < max_index; ++index)
+                    {
+                        observations[index] = const_cast< typename D::observation_type* >(estimated->get_observation(states[index]));
+                        weights[index] = pi[states[index]];
+                        origins[index] = origins[states[index]];
+                    }
+                    for(Index state = states.size(), max_state = origins.size(); state < max_state; ++state)
+                    { estimator.set_estimator(state, nullptr); }
+                    origins.resize(states.size());
+                    next = new D(observations, weights);
+                }
+                delete mixture;
+                mixture = next;
+            }
+            selection->finalize();
+            if(!selection->get_estimated())
+            {
+                delete selection;
+                throw std::runtime_error("All estimations failed, perform manually the estimation in order to investigate what went wrong");
+            }
+            std::unique_ptr< typename E::Estimator::estimation_type > estimation;
+            if(lazy)
+            {
+                estimation = std::make_unique< LazyEstimation< D, E > >(static_cast< D* >(selection->get_estimated()->copy().release()));
+                delete selection;
+            }
+            else
+            { estimation.reset(selection); }
+            return estimation;
+        }
+
+    template<class D, class E>
+        std::unique_ptr< typename E::Estimator::estimation_type::Estimator > MixtureDistributionEMSelection< D, E >::Estimator::copy() const
+        { return std::make_unique< Estimator >(*this); }
+
+    template<class D, class E>
+        const typename MixtureDistributionEMSelection< D, E >::Estimator::criterion_type& MixtureDistributionEMSelection< D, E >::Estimator::get_criterion() const
+        { return _criterion; }
+
+    template<class D, class E>
+        void MixtureDistributionEMSelection< D, E >::Estimator::set_criterion(const criterion_type& criterion)
+        { _criterion = criterion; }
+
+    template<class D, class E>
+        const double& MixtureDistributionEMSelection< D, E >::Estimator::get_threshold() const
+        { return _threshold; }
+
+    template<class D, class E>
+        void MixtureDistributionEMSelection< D, E >::Estimator::set_threshold(const double& threshold)
+        {
+            if(threshold < 0. || threshold >= 1.)
+            { throw interval_error("threshold", threshold, 0., 1., std::make_pair(false, true)); }
+            _threshold = threshold;
+        }
+
+    template<class D, class E>
+        MixtureDistributionCEMEstimation< D, E >::MixtureDistributionCEMEstimation() : MixtureDistributionEMEstimation< D, E >()
+        {}
+
+    template<class D, class E>
+        MixtureDistributionCEMEstimation< D, E >::MixtureDistributionCEMEstimation(D const * estimated, typename E::data_type const * data) : MixtureDistributionEMEstimation< D, E >(estimated, data)
+        {}
+
+    template<class D, class E>
+        MixtureDistributionCEMEstimation< D, E >::MixtureDistributionCEMEstimation(const MixtureDistributionCEMEstimation< D, E >& estimation) : MixtureDistributionEMEstimation< D, E >(estimation)
+        {}
+
+    template<class D, class E>
+        MixtureDistributionCEMEstimation< D, E >::~MixtureDistributionCEMEstimation()
+        {}
+
+    template<class D, class E>
+        MixtureDistributionCEMEstimation< D, E >::Estimator::Estimator() : MixtureDistributionEMEstimation< D, E >::Estimator()
+        {}
+
+    template<class D, class E>
+        MixtureDistributionCEMEstimation< D, E >::Estimator::Estimator(const Estimator& estimator) : MixtureDistributionEMEstimation< D, E >::Estimator(estimator)
+        {}
+
+    template<class D, class E>
+        MixtureDistributionCEMEstimation< D, E >::Estimator::~Estimator()
+        {}
+
+    template<class D, class E>
+        std::unique_ptr< typename E::Estimator::estimation_type::Estimator > MixtureDistributionCEMEstimation< D, E >::Estimator::copy() const
+        { return std::make_unique< Estimator >(*this); }
+
+    template<class D, class E>
+        std::unique_ptr< typename E::Estimator::estimation_type > MixtureDistributionCEMEstimation< D, E >::Estimator::create(D* mixture, const typename E::Estimator::estimation_type::data_type& data, const bool& lazy) const
+        {
+            std::unique_ptr< typename E::Estimator::estimation_type > estimation;
+            if(lazy)
+            { estimation = std::make_unique< LazyEstimation< D, MixtureDistributionCEMEstimation< D, E > > >(mixture); }
+            else
+            { estimation = std::make_unique< MixtureDistributionCEMEstimation< D, E > >(mixture, &data); }
+            return estimation;
+        }
+
+    template<class D, class E>
+        Eigen::VectorXd MixtureDistributionCEMEstimation< D, E >::Estimator::expectation(const D& mixture, const typename D::data_type::event_type* event) const
+        {
+            Eigen::VectorXd p = Eigen::VectorXd::Zero(mixture.get_nb_states());
+            p[mixture.assignement(event)] = 1.;
+            return p;
+        }
+
+    template<class D, class E>
+        double MixtureDistributionCEMEstimation< D, E >::Estimator::criterion(const D& mixture, const typename E::Estimator::estimation_type::data_type& data) const
+        {
+            double llh = 0.;
+            std::unique_ptr< typename E::Estimator::estimation_type::data_type::Generator > generator = data.generator();
+            while(generator->is_valid())
+            {
+                double max = -1 * std::numeric_limits< double >::infinity();
+                for(Index state = 0, max_state = mixture.get_nb_states(); state < max_state; ++state)
+                { max = std::max(max, log(mixture.get_pi()[state]) + mixture.get_observation(state)->probability(generator->event(), true)); }
+                llh += generator->weight() * max;
+                ++(*generator);
+            }
+            return llh;
+        }
 
 }
 
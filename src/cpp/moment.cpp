@@ -10,6 +10,109 @@
 
 namespace statiskit
 {
+    namespace __impl
+    {
+        bool extract(const MultivariateEvent* event, Eigen::Ref< Eigen::VectorXd > values)
+        {
+            bool complete = true;
+            for(Index index = 0, max_index = event->size(); complete && index < max_index; ++index)
+            {
+                const UnivariateEvent* component = event->get(index);
+                if(component && component->get_event() == ELEMENTARY)
+                {
+                    switch(component->get_outcome())
+                    {
+                        case DISCRETE:
+                            values(index) = static_cast< const DiscreteElementaryEvent* >(component)->get_value();
+                            break;
+                        case CONTINUOUS:
+                            values(index) = static_cast< const ContinuousElementaryEvent* >(component)->get_value();
+                            break;
+                        default:
+                            throw qualitative_sample_space_error();
+                            break;
+                    }
+                }
+                else
+                { complete = false; }
+            }
+            return complete;
+        }
+
+        void observations(const UnivariateData& data, std::vector< std::pair< double, double > >& table)
+        {
+            std::unique_ptr< UnivariateData::Generator > generator = data.generator();
+            while(generator->is_valid())
+            {
+                const UnivariateEvent* event = generator->event();
+                if(event && event->get_event() == ELEMENTARY && generator->weight() > 0.)
+                {
+                    switch(event->get_outcome())
+                    {
+                        case DISCRETE:
+                            table.push_back(std::make_pair(static_cast< const DiscreteElementaryEvent* >(event)->get_value(), generator->weight()));
+                            break;
+                        case CONTINUOUS:
+                            table.push_back(std::make_pair(static_cast< const ContinuousElementaryEvent* >(event)->get_value(), generator->weight()));
+                            break;
+                        default:
+                            throw qualitative_sample_space_error();
+                            break;
+                    }
+                }
+                ++(*generator);
+            }
+        }
+
+        typedef std::vector< std::pair< double, double > >::iterator observation_iterator;
+
+        observation_iterator select(observation_iterator first, observation_iterator last, double target, double& before)
+        {
+            // Find the observation where the cumulative weight in sorted order reaches the target, the range being partitioned around it
+            before = 0.;
+            while(last - first > 1)
+            {
+                observation_iterator middle = first + (last - first) / 2;
+                std::nth_element(first, middle, last);
+                double left = 0.;
+                for(observation_iterator it = first; it != middle; ++it)
+                { left += it->second; }
+                if(target <= left)
+                { last = middle; }
+                else if(target <= left + middle->second || middle + 1 == last)
+                {
+                    before += left;
+                    return middle;
+                }
+                else
+                {
+                    target -= left + middle->second;
+                    before += left + middle->second;
+                    first = middle + 1;
+                }
+            }
+            return first;
+        }
+
+        void select(observation_iterator first, observation_iterator last, const std::vector< double >& targets, const Index& begin, const Index& end, const double& offset, std::vector< double >& quantiles)
+        {
+            if(begin < end)
+            {
+                Index middle = begin + (end - begin) / 2;
+                double before;
+                observation_iterator position = select(first, last, targets[middle] - offset, before);
+                double through = offset + before + position->second;
+                Index lower = begin, upper = std::upper_bound(targets.cbegin() + middle, targets.cbegin() + end, through) - targets.cbegin();
+                if(position != first)
+                { lower = std::upper_bound(targets.cbegin() + begin, targets.cbegin() + middle, offset + before) - targets.cbegin(); }
+                for(Index index = lower; index < upper; ++index)
+                { quantiles[index] = position->first; }
+                select(first, position, targets, begin, lower, offset, quantiles);
+                select(position + 1, last, targets, upper, end, through, quantiles);
+            }
+        }
+    }
+
     qualitative_sample_space_error::qualitative_sample_space_error() : parameter_error("data", "unexpected " + __impl::to_string(CATEGORICAL) + " outcome")
     {}
 
@@ -196,276 +299,1497 @@ namespace statiskit
     void NaturalVarianceEstimation::Estimator::set_bias(const bool& bias)
     { _bias = bias; }
 
-    CovarianceMatrixEstimation::CovarianceMatrixEstimation(const Eigen::VectorXd& mean)
-    { _mean = mean; }
+    UnivariateMomentStatistic::UnivariateMomentStatistic()
+    { reset(); }
 
-    CovarianceMatrixEstimation::CovarianceMatrixEstimation(const CovarianceMatrixEstimation& estimation)
-    { _mean = estimation._mean; }
+    UnivariateMomentStatistic::UnivariateMomentStatistic(const UnivariateMomentStatistic& statistic)
+    {
+        _total = statistic._total;
+        _total_square = statistic._total_square;
+        _mean = statistic._mean;
+        _m2 = statistic._m2;
+        _m3 = statistic._m3;
+        _m4 = statistic._m4;
+        _minimum = statistic._minimum;
+        _maximum = statistic._maximum;
+    }
 
-    const Eigen::VectorXd& CovarianceMatrixEstimation::get_mean() const
-    { return _mean; }
+    UnivariateMomentStatistic::~UnivariateMomentStatistic()
+    {}
 
-    NaturalCovarianceMatrixEstimation::NaturalCovarianceMatrixEstimation(const Eigen::VectorXd& mean, const Eigen::MatrixXd& covariance, const bool& bias) : CovarianceMatrixEstimation(mean)
-    { 
-        _covariance = covariance;
-        _bias = bias;
+    UnivariateMomentStatistic& UnivariateMomentStatistic::operator=(const UnivariateMomentStatistic& statistic)
+    {
+        _total = statistic._total;
+        _total_square = statistic._total_square;
+        _mean = statistic._mean;
+        _m2 = statistic._m2;
+        _m3 = statistic._m3;
+        _m4 = statistic._m4;
+        _minimum = statistic._minimum;
+        _maximum = statistic._maximum;
+        return *this;
     }
 
-    NaturalCovarianceMatrixEstimation::NaturalCovarianceMatrixEstimation(const NaturalCovarianceMatrixEstimation& estimation) : CovarianceMatrixEstimation(estimation)
+    void UnivariateMomentStatistic::update(const UnivariateEvent* event, const double& weight)
     {
-        _covariance = estimation._covariance;
-        _bias = estimation._bias;
+        if(event && event->get_event() == ELEMENTARY && weight > 0.)
+        {
+            switch(event->get_outcome())
+            {
+                case DISCRETE:
+                    accumulate(static_cast< const DiscreteElementaryEvent* >(event)->get_value(), weight);
+                    break;
+                case CONTINUOUS:
+                    accumulate(static_cast< const ContinuousElementaryEvent* >(event)->get_value(), weight);
+                    break;
+                default:
+                    throw qualitative_sample_space_error();
+                    break;
+            }
+        }
     }
 
-    const bool& NaturalCovarianceMatrixEstimation::get_bias() const
-    { return _bias; }
-
-    const Eigen::MatrixXd& NaturalCovarianceMatrixEstimation::get_covariance() const
-    { return _covariance; }
-
-    NaturalCovarianceMatrixEstimation::Estimator::Estimator()
-    { _bias = false; }
-
-    NaturalCovarianceMatrixEstimation::Estimator::Estimator(const bool& bias)
-    { _bias = bias; }
-
-    NaturalCovarianceMatrixEstimation::Estimator::Estimator(const Estimator& estimator)
-    { _bias = estimator._bias; }
-
-    std::unique_ptr< CovarianceMatrixEstimation > NaturalCovarianceMatrixEstimation::Estimator::operator() (const MultivariateData& data, const Eigen::VectorXd& mean) const
+    void UnivariateMomentStatistic::update(const UnivariateData& data)
     {
-        Eigen::MatrixXd covariance = Eigen::MatrixXd(mean.size(), mean.size());
-        for(Index i = 0, max_i = mean.size(); i < max_i; ++i)
+        std::unique_ptr< UnivariateData::Generator > generator = data.generator();
+        if(get_nb_threads() > 1)
+        {
+            std::vector< double > values, weights;
+            while(generator->is_valid())
+            {
+                const UnivariateEvent* event = generator->event();
+                if(event && event->get_event() == ELEMENTARY && generator->weight() > 0.)
+                {
+                    switch(event->get_outcome())
+                    {
+                        case DISCRETE:
+                            values.push_back(static_cast< const DiscreteElementaryEvent* >(event)->get_value());
+                            break;
+                        case CONTINUOUS:
+                            values.push_back(static_cast< const ContinuousElementaryEvent* >(event)->get_value());
+                            break;
+                        default:
+                            throw qualitative_sample_space_error();
+                            break;
+                    }
+                    weights.push_back(generator->weight());
+                }
+                ++(*generator);
+            }
+            Index nb_blocks = std::min< Index >(get_nb_threads(), values.size());
+            std::vector< UnivariateMomentStatistic > statistics(nb_blocks);
+            __impl::parallel_for(nb_blocks, [&values, &weights, &statistics, nb_blocks](const Index& block)
+            {
+                for(Index index = block * values.size() / nb_blocks, max_index = (block + 1) * values.size() / nb_blocks; index < max_index; ++index)
+                { statistics[block].accumulate(values[index], weights[index]); }
+            });
+            for(Index block = 0; block < nb_blocks; ++block)
+            { merge(statistics[block]); }
+        }
+        else
         {
-            covariance(i, i) = compute(data, mean, i, i);
-            for(Index j = 0; j < i; ++j)
+            while(generator->is_valid())
             {
-                covariance(i, j) = compute(data, mean, i, j);
-                covariance(j, i) = covariance(i, j);
+                update(generator->event(), generator->weight());
+                ++(*generator);
             }
         }
-        if(!_bias)
-        {}
-        return std::make_unique< NaturalCovarianceMatrixEstimation >(mean, covariance, _bias);
     }
 
-    std::unique_ptr< CovarianceMatrixEstimation::Estimator > NaturalCovarianceMatrixEstimation::Estimator::copy() const
-    { return std::make_unique< Estimator >(*this); }
+    void UnivariateMomentStatistic::merge(const UnivariateMomentStatistic& statistic)
+    {
+        if(statistic._total > 0.)
+        {
+            double total = _total + statistic._total, delta = statistic._mean - _mean, product = _total * statistic._total;
+            _m4 += statistic._m4 + pow(delta, 4) * product * (pow(_total, 2) - product + pow(statistic._total, 2)) / pow(total, 3)
+                   + 6. * pow(delta, 2) * (pow(_total, 2) * statistic._m2 + pow(statistic._total, 2) * _m2) / pow(total, 2)
+                   + 4. * delta * (_total * statistic._m3 - statistic._total * _m3) / total;
+            _m3 += statistic._m3 + pow(delta, 3) * product * (_total - statistic._total) / pow(total, 2)
+                   + 3. * delta * (_total * statistic._m2 - statistic._total * _m2) / total;
+            _m2 += statistic._m2 + pow(delta, 2) * product / total;
+            _mean += delta * statistic._total / total;
+            _total = total;
+            _total_square += statistic._total_square;
+            _minimum = std::min(_minimum, statistic._minimum);
+            _maximum = std::max(_maximum, statistic._maximum);
+        }
+    }
 
-    const bool& NaturalCovarianceMatrixEstimation::Estimator::get_bias() const
-    { return _bias; }
+    void UnivariateMomentStatistic::reset()
+    {
+        _total = 0.;
+        _total_square = 0.;
+        _mean = 0.;
+        _m2 = 0.;
+        _m3 = 0.;
+        _m4 = 0.;
+        _minimum = std::numeric_limits< double >::infinity();
+        _maximum = -1 * std::numeric_limits< double >::infinity();
+    }
 
-    void NaturalCovarianceMatrixEstimation::Estimator::set_bias(const bool& bias)
-    { _bias = bias; }
+    const double& UnivariateMomentStatistic::get_total() const
+    { return _total; }
+
+    const double& UnivariateMomentStatistic::get_total_square() const
+    { return _total_square; }
+
+    const double& UnivariateMomentStatistic::get_mean() const
+    { return _mean; }
+
+    double UnivariateMomentStatistic::get_variance(const bool& bias) const
+    {
+        double variance = _m2 / _total;
+        if(!bias)
+        {
+            double total = pow(_total, 2);
+            variance *= total / (total - _total_square);
+        }
+        return variance;
+    }
 
-    double NaturalCovarianceMatrixEstimation::Estimator::compute(const MultivariateData& data, const Eigen::VectorXd& mean, const Index& i, const Index& j) const
+    double UnivariateMomentStatistic::get_central_moment(const unsigned int& order) const
     {
-        double covariance = 0., total = 0., total_square = 0.;
-        switch(data.get_sample_space()->get(i)->get_outcome())
+        double moment;
+        switch(order)
         {
-            case CATEGORICAL:
-                covariance = std::numeric_limits< double >::quiet_NaN();
+            case 0:
+                moment = 1.;
                 break;
-            case DISCRETE:
-                switch(data.get_sample_space()->get(j)->get_outcome())
-                {
-                    case CATEGORICAL:
-                        covariance = std::numeric_limits< double >::quiet_NaN();
-                        break;
-                    case DISCRETE:
-                        {
-                            std::unique_ptr< MultivariateData::Generator > generator = data.generator();
-                            while(generator->is_valid())
-                            {
-                                double _covariance = 0;
-                                const UnivariateEvent* event = generator->event()->get(i);
-                                if(event && event->get_event() == ELEMENTARY)
-                                { 
-                                    _covariance = static_cast< const DiscreteElementaryEvent* >(event)->get_value() - mean(i);
-                                    event = generator->event()->get(j);
-                                    if(event && event->get_event() == ELEMENTARY)
-                                    {
-                                        _covariance *= static_cast< const DiscreteElementaryEvent* >(event)->get_value() - mean(j);
-                                        covariance += _covariance * generator->weight();
-                                        total += generator->weight();
-                                        total_square += pow(generator->weight(), 2);
-                                    }
-                                }
-                                ++(*generator);
-                            }
-                        }
-                        break;
-                    case CONTINUOUS:
-                        {
-                            std::unique_ptr< MultivariateData::Generator > generator = data.generator();
-                            while(generator->is_valid())
-                            {
-                                double _covariance = 0;
-                                const UnivariateEvent* event = generator->event()->get(i);
-                                if(event && event->get_event() == ELEMENTARY)
-                                { 
-                                    _covariance = static_cast< const DiscreteElementaryEvent* >(event)->get_value() - mean(i);
-                                    event = generator->event()->get(j);
-                                    if(event && event->get_event() == ELEMENTARY)
-                                    {
-                                        _covariance *= static_cast< const ContinuousElementaryEvent* >(event)->get_value() - mean(j);
-                                        covariance += _covariance * generator->weight();
-                                        total += generator->weight();
-                                        total_square += pow(generator->weight(), 2);
-                                    }
-                                }
-                                ++(*generator);
-                            }
-                        }
-                        break;
-                }
+            case 1:
+                moment = 0.;
                 break;
-            case CONTINUOUS:
-                switch(data.get_sample_space()->get(j)->get_outcome())
-                {
-                    case CATEGORICAL:
-                        covariance = std::numeric_limits< double >::quiet_NaN();
-                        break;
-                    case DISCRETE:
-                        {
-                            std::unique_ptr< MultivariateData::Generator > generator = data.generator();
-                            while(generator->is_valid())
-                            {
-                                double _covariance = 0;
-                                const UnivariateEvent* event = generator->event()->get(i);
-                                if(event && event->get_event() == ELEMENTARY)
-                                { 
-                                    _covariance = static_cast< const ContinuousElementaryEvent* >(event)->get_value() - mean(i);
-                                    event = generator->event()->get(j);
-                                    if(event && event->get_event() == ELEMENTARY)
-                                    {
-                                        _covariance *= static_cast< const DiscreteElementaryEvent* >(event)->get_value() - mean(j);
-                                        covariance += _covariance * generator->weight();
-                                        total += generator->weight();
-                                        total_square += pow(generator->weight(), 2);
-                                    }
-                                }
-                                ++(*generator);
-                            }
-                        }
-                        break;
-                    case CONTINUOUS:
-                        {
-                            std::unique_ptr< MultivariateData::Generator > generator = data.generator();
-                            while(generator->is_valid())
-                            {
-                                double _covariance = 0;
-                                const UnivariateEvent* event = generator->event()->get(i);
-                                if(event && event->get_event() == ELEMENTARY)
-                                { 
-                                    _covariance = static_cast< const ContinuousElementaryEvent* >(event)->get_value() - mean(i);
-                                    event = generator->event()->get(j);
-                                    if(event && event->get_event() == ELEMENTARY)
-                                    {
-                                        _covariance *= static_cast< const ContinuousElementaryEvent* >(event)->get_value() - mean(j);
-                                        covariance += _covariance * generator->weight();
-                                        total += generator->weight();
-                                        total_square += pow(generator->weight(), 2);
-                                    }
-                                }
-                                ++(*generator);
-                            }
-                        }
-                        break;
-                }
+            case 2:
+                moment = _m2 / _total;
+                break;
+            case 3:
+                moment = _m3 / _total;
+                break;
+            case 4:
+                moment = _m4 / _total;
+                break;
+            default:
+                throw interval_error("order", order, 0, 4, std::make_pair(false, false));
                 break;
         }
-        covariance /= total;
-        if(!_bias)
-        { 
-            total = pow(total, 2.);
-            covariance *= total / (total - total_square);
-        }
-        return covariance;
+        return moment;
     }
-    /*CoVarianceEstimation::CoVarianceEstimation(const std::array< double, 2 >& means)
-    { _means = means; }
 
-    CoVarianceEstimation::CoVarianceEstimation(const CoVarianceEstimation& estimation)
-    { _means = estimation._means; }
+    const double& UnivariateMomentStatistic::get_minimum() const
+    { return _minimum; }
 
-    const std::array< double, 2 >& CoVarianceEstimation::get_means() const
-    { return _means; }
-    
-    std::unique_ptr< CoVarianceEstimation > CoVarianceEstimation::Estimator::operator() (const UnivariateData& data) const
+    const double& UnivariateMomentStatistic::get_maximum() const
+    { return _maximum; }
+
+    void UnivariateMomentStatistic::accumulate(const double& value, const double& weight)
     {
-        NaturalMeanEstimation::Estimator estimator = NaturalMeanEstimation::Estimator();
-        std::unique_ptr< MeanEstimation > estimation = estimator(data);
-        double mean = estimation->get_mean();
-        return operator() (data, mean);
+        double total = _total + weight, delta = value - _mean, product = _total * weight, ratio = delta * weight / total;
+        _m4 += pow(delta, 4) * product * (pow(_total, 2) - product + pow(weight, 2)) / pow(total, 3) + 6. * pow(ratio, 2) * _m2 - 4. * ratio * _m3;
+        _m3 += pow(delta, 3) * product * (_total - weight) / pow(total, 2) - 3. * ratio * _m2;
+        _m2 += delta * ratio * _total;
+        _mean += ratio;
+        _total = total;
+        _total_square += pow(weight, 2);
+        _minimum = std::min(_minimum, value);
+        _maximum = std::max(_maximum, value);
     }
 
-    std::unique_ptr< CoVarianceEstimation > CoVarianceEstimation::Estimator::operator() (const UnivariateData& data, const double& mean) const
+    MultivariateMomentStatistic::MultivariateMomentStatistic()
+    { reset(); }
+
+    MultivariateMomentStatistic::MultivariateMomentStatistic(const MultivariateMomentStatistic& statistic)
     {
-        std::unique_ptr< MultivariateDataFrame > datas = std::make_unique< MultivariateDataFrame >();
-        datas->append_component(data);
-        datas->append_component(data);
-        std::array< double, 2 > means{ {mean, mean} };
-        return operator() (0, 1, datas, means);
+        _total = statistic._total;
+        _total_square = statistic._total_square;
+        _mean = statistic._mean;
+        _m2 = statistic._m2;
     }
 
-    std::unique_ptr< CoVarianceEstimation > CoVarianceEstimation::Estimator::operator() (const Index& i, const Index& j, const std::unique_ptr< MultivariateDataFrame > data) const
+    MultivariateMomentStatistic::~MultivariateMomentStatistic()
+    {}
+
+    MultivariateMomentStatistic& MultivariateMomentStatistic::operator=(const MultivariateMomentStatistic& statistic)
     {
-        NaturalMeanEstimation::Estimator estimator = NaturalMeanEstimation::Estimator();
-        std::unique_ptr< MeanEstimation > estimation_i = estimator(data.get_component(i));
-        std::unique_ptr< MeanEstimation > estimation_j = estimator(data.get_component(j));
-        std::array< double, 2 > means{ {estimation_i->get_mean(), estimation_j->get_mean()} };
-        return operator() (i, j, data, means);
+        _total = statistic._total;
+        _total_square = statistic._total_square;
+        _mean = statistic._mean;
+        _m2 = statistic._m2;
+        return *this;
     }
 
-    NaturalCoVarianceEstimation::NaturalCoVarianceEstimation(const std::array< double, 2 >& means, const double& covariance, const bool& bias) : CoVarianceEstimation(means)
+    void MultivariateMomentStatistic::update(const MultivariateEvent* event, const double& weight)
     {
-        _covariance = covariance;
-        _bias = bias;
+        if(event && weight > 0.)
+        {
+            Eigen::VectorXd values = Eigen::VectorXd(event->size());
+            if(__impl::extract(event, values))
+            { accumulate(values, weight); }
+        }
     }
 
-    NaturalCoVarianceEstimation::NaturalCoVarianceEstimation(const NaturalCoVarianceEstimation& estimation) : CoVarianceEstimation(estimation)
+    void MultivariateMomentStatistic::update(const MultivariateData& data)
     {
-        _covariance = estimation._covariance;
-        _bias = estimation._bias;
+        std::unique_ptr< MultivariateData::Generator > generator = data.generator();
+        if(get_nb_threads() > 1)
+        {
+            Index size = data.get_sample_space()->size(), nb_events = 0;
+            Eigen::MatrixXd values = Eigen::MatrixXd(size, 0);
+            std::vector< double > weights;
+            while(generator->is_valid())
+            {
+                if(generator->event() && generator->weight() > 0.)
+                {
+                    if(nb_events == Index(values.cols()))
+                    { values.conservativeResize(Eigen::NoChange, std::max< Index >(2 * nb_events, 64)); }
+                    if(__impl::extract(generator->event(), values.col(nb_events)))
+                    {
+                        weights.push_back(generator->weight());
+                        ++nb_events;
+                    }
+                }
+                ++(*generator);
+            }
+            Index nb_blocks = std::min< Index >(get_nb_threads(), nb_events);
+            std::vector< MultivariateMomentStatistic > statistics(nb_blocks);
+            __impl::parallel_for(nb_blocks, [&values, &weights, &statistics, nb_events, nb_blocks](const Index& block)
+            {
+                for(Index index = block * nb_events / nb_blocks, max_index = (block + 1) * nb_events / nb_blocks; index < max_index; ++index)
+                { statistics[block].accumulate(values.col(index), weights[index]); }
+            });
+            for(Index block = 0; block < nb_blocks; ++block)
+            { merge(statistics[block]); }
+        }
+        else
+        {
+            while(generator->is_valid())
+            {
+                update(generator->event(), generator->weight());
+                ++(*generator);
+            }
+        }
     }
 
-    const bool& NaturalCoVarianceEstimation::get_bias() const
-    { return _bias; }
+    void MultivariateMomentStatistic::merge(const MultivariateMomentStatistic& statistic)
+    {
+        if(statistic._total > 0.)
+        {
+            if(_total > 0.)
+            {
+                if(_mean.size() != statistic._mean.size())
+                { throw size_error("statistic", statistic._mean.size(), _mean.size()); }
+                double total = _total + statistic._total;
+                Eigen::VectorXd delta = statistic._mean - _mean;
+                _m2 += statistic._m2;
+                _m2.selfadjointView< Eigen::Lower >().rankUpdate(delta, _total * statistic._total / total);
+                _mean += delta * statistic._total / total;
+                _total = total;
+                _total_square += statistic._total_square;
+            }
+            else
+            { *this = statistic; }
+        }
+    }
 
-    const double& NaturalCoVarianceEstimation::get_covariance() const
-    { return _covariance; }
+    void MultivariateMomentStatistic::reset()
+    {
+        _total = 0.;
+        _total_square = 0.;
+        _mean = Eigen::VectorXd();
+        _m2 = Eigen::MatrixXd();
+    }
 
-    NaturalCoVarianceEstimation::Estimator::Estimator(const bool& bias)
-    { _bias = bias; }
+    const double& MultivariateMomentStatistic::get_total() const
+    { return _total; }
 
-    NaturalCoVarianceEstimation::Estimator::Estimator(const Estimator& estimator)
-    { _bias = estimator._bias; }
+    const double& MultivariateMomentStatistic::get_total_square() const
+    { return _total_square; }
 
-    std::unique_ptr< CoVarianceEstimation > NaturalCoVarianceEstimation::Estimator::operator() (const Index& i, const Index& j, const std::unique_ptr< MultivariateDataFrame > data, const std::array< double, 2 >& means) const
+    const Eigen::VectorXd& MultivariateMomentStatistic::get_mean() const
+    { return _mean; }
+
+    Eigen::MatrixXd MultivariateMomentStatistic::get_covariance(const bool& bias) const
     {
-        if(!data)
-        { throw std::runtime_error("None"); }
-        if(!*data)
-        { throw std::runtime_error("invalid"); }
-        double total = data.compute_total(), covariance;
-        if(total > 0 && data.size() > 0 && boost::math::isfinite(means.at(0) + means.at(1)))
+        Eigen::MatrixXd covariance = _m2.selfadjointView< Eigen::Lower >();
+        covariance /= _total;
+        if(!bias)
         {
-            Index index = 0, max_index = data.size();
-            double total_square = 0;
-            const UnivariateData&& data_i = data.get_component(i), data_j = data.get_component(j);
-            switch(data_i->get_sample_space()->get_outcome())
-            {
-                case CATEGORICAL:
-                    covariance = std::numeric_limits< double >::quiet_NaN();
-                    break;
-                case DISCRETE:
-                    switch(data_j->get_sample_space()->get_outcome())
-                    {
-                        case CATEGORICAL:
-                            covariance = std::numeric_limits< double >::quiet_NaN();
-                            break;
-                        case DISCRETE:
+            double total = pow(_total, 2);
+            covariance *= total / (total - _total_square);
+        }
+        return covariance;
+    }
+
+    void MultivariateMomentStatistic::accumulate(const Eigen::Ref< const Eigen::VectorXd >& values, const double& weight)
+    {
+        if(_total == 0.)
+        {
+            _mean = Eigen::VectorXd::Zero(values.size());
+            _m2 = Eigen::MatrixXd::Zero(values.size(), values.size());
+        }
+        else if(_mean.size() != values.size())
+        { throw size_error("event", values.size(), _mean.size()); }
+        double total = _total + weight;
+        Eigen::VectorXd delta = values - _mean;
+        _m2.selfadjointView< Eigen::Lower >().rankUpdate(delta, _total * weight / total);
+        _mean += delta * weight / total;
+        _total = total;
+        _total_square += pow(weight, 2);
+    }
+
+    MultivariateCoMomentStatistic::MultivariateCoMomentStatistic()
+    {
+        _block = 256;
+        reset();
+    }
+
+    MultivariateCoMomentStatistic::MultivariateCoMomentStatistic(const MultivariateCoMomentStatistic& statistic)
+    {
+        _total = statistic._total;
+        _mean = statistic._mean;
+        _m11 = statistic._m11;
+        _m21 = statistic._m21;
+        _m22 = statistic._m22;
+        _m31 = statistic._m31;
+        _block = statistic._block;
+    }
+
+    MultivariateCoMomentStatistic::~MultivariateCoMomentStatistic()
+    {}
+
+    MultivariateCoMomentStatistic& MultivariateCoMomentStatistic::operator=(const MultivariateCoMomentStatistic& statistic)
+    {
+        _total = statistic._total;
+        _mean = statistic._mean;
+        _m11 = statistic._m11;
+        _m21 = statistic._m21;
+        _m22 = statistic._m22;
+        _m31 = statistic._m31;
+        _block = statistic._block;
+        return *this;
+    }
+
+    void MultivariateCoMomentStatistic::update(const MultivariateEvent* event, const double& weight)
+    {
+        if(event && weight > 0.)
+        {
+            Eigen::MatrixXd values = Eigen::MatrixXd(event->size(), 1);
+            if(__impl::extract(event, values.col(0)))
+            { accumulate(values, Eigen::VectorXd::Constant(1, weight)); }
+        }
+    }
+
+    void MultivariateCoMomentStatistic::update(const MultivariateData& data)
+    {
+        Index size = data.get_sample_space()->size(), nb_events = 0;
+        Eigen::MatrixXd values = Eigen::MatrixXd(size, _block);
+        Eigen::VectorXd weights = Eigen::VectorXd(_block);
+        bool parallel = get_nb_threads() > 1;
+        std::unique_ptr< MultivariateData::Generator > generator = data.generator();
+        while(generator->is_valid())
+        {
+            if(generator->event() && generator->weight() > 0.)
+            {
+                if(nb_events == Index(values.cols()))
+                {
+                    if(parallel)
+                    {
+                        values.conservativeResize(Eigen::NoChange, 2 * nb_events);
+                        weights.conservativeResize(2 * nb_events);
+                    }
+                    else
+                    {
+                        accumulate(values, weights);
+                        nb_events = 0;
+                    }
+                }
+                if(__impl::extract(generator->event(), values.col(nb_events)))
+                {
+                    weights(nb_events) = generator->weight();
+                    ++nb_events;
+                }
+            }
+            ++(*generator);
+        }
+        if(parallel)
+        {
+            Index nb_blocks = (nb_events + _block - 1) / _block, nb_threads = std::min< Index >(get_nb_threads(), nb_blocks);
+            std::vector< MultivariateCoMomentStatistic > statistics(nb_threads, *this);
+            for(Index thread = 0; thread < nb_threads; ++thread)
+            { statistics[thread].reset(); }
+            __impl::parallel_for(nb_threads, [this, &values, &weights, &statistics, nb_events, nb_blocks, nb_threads](const Index& thread)
+            {
+                for(Index block = thread * nb_blocks / nb_threads, max_block = (thread + 1) * nb_blocks / nb_threads; block < max_block; ++block)
+                {
+                    Index first = block * _block, last = std::min(first + _block, nb_events);
+                    statistics[thread].accumulate(values.middleCols(first, last - first), weights.segment(first, last - first));
+                }
+            });
+            for(Index thread = 0; thread < nb_threads; ++thread)
+            { merge(statistics[thread]); }
+        }
+        else if(nb_events > 0)
+        { accumulate(values.leftCols(nb_events), weights.head(nb_events)); }
+    }
+
+    void MultivariateCoMomentStatistic::merge(const MultivariateCoMomentStatistic& statistic)
+    {
+        if(statistic._total > 0.)
+        {
+            if(_total > 0.)
+            {
+                if(_mean.size() != statistic._mean.size())
+                { throw size_error("statistic", statistic._mean.size(), _mean.size()); }
+                double total = _total + statistic._total;
+                Eigen::VectorXd delta = statistic._mean - _mean;
+                MultivariateCoMomentStatistic other = statistic;
+                other.shift(delta * _total / total);
+                shift(-delta * statistic._total / total);
+                _m11 += other._m11;
+                _m21 += other._m21;
+                _m22 += other._m22;
+                _m31 += other._m31;
+                _mean += delta * statistic._total / total;
+                _total = total;
+            }
+            else
+            {
+                Index block = _block;
+                *this = statistic;
+                _block = block;
+            }
+        }
+    }
+
+    void MultivariateCoMomentStatistic::reset()
+    {
+        _total = 0.;
+        _mean = Eigen::VectorXd();
+        _m11 = Eigen::MatrixXd();
+        _m21 = Eigen::MatrixXd();
+        _m22 = Eigen::MatrixXd();
+        _m31 = Eigen::MatrixXd();
+    }
+
+    const double& MultivariateCoMomentStatistic::get_total() const
+    { return _total; }
+
+    const Eigen::VectorXd& MultivariateCoMomentStatistic::get_mean() const
+    { return _mean; }
+
+    Eigen::MatrixXd MultivariateCoMomentStatistic::get_comoment(const unsigned int& p, const unsigned int& q) const
+    {
+        Eigen::MatrixXd comoment;
+        if(p == 1 && q == 1)
+        { comoment = _m11; }
+        else if(p == 2 && q == 1)
+        { comoment = _m21; }
+        else if(p == 1 && q == 2)
+        { comoment = _m21.transpose(); }
+        else if(p == 2 && q == 2)
+        { comoment = _m22; }
+        else if(p == 3 && q == 1)
+        { comoment = _m31; }
+        else if(p == 1 && q == 3)
+        { comoment = _m31.transpose(); }
+        else
+        { throw parameter_error("order", "co-moments are only computed for positive orders with a sum lower than 4"); }
+        return comoment / _total;
+    }
+
+    Eigen::MatrixXd MultivariateCoMomentStatistic::get_coskewness() const
+    {
+        Eigen::ArrayXd variance = _m11.diagonal().array() / _total;
+        return ((_m21.array() / _total).colwise() / variance).rowwise() / variance.sqrt().transpose();
+    }
+
+    Eigen::MatrixXd MultivariateCoMomentStatistic::get_cokurtosis() const
+    {
+        Eigen::ArrayXd variance = _m11.diagonal().array() / _total;
+        return ((_m22.array() / _total).colwise() / variance).rowwise() / variance.transpose();
+    }
+
+    const Index& MultivariateCoMomentStatistic::get_block() const
+    { return _block; }
+
+    void MultivariateCoMomentStatistic::set_block(const Index& block)
+    {
+        if(block == 0)
+        { throw lower_bound_error("block", 0, 0, true); }
+        _block = block;
+    }
+
+    void MultivariateCoMomentStatistic::accumulate(const Eigen::Ref< const Eigen::MatrixXd >& values, const Eigen::Ref< const Eigen::VectorXd >& weights)
+    {
+        MultivariateCoMomentStatistic statistic = MultivariateCoMomentStatistic();
+        statistic._total = weights.sum();
+        statistic._mean = values * weights / statistic._total;
+        Eigen::ArrayXXd deviations = values.colwise() - statistic._mean;
+        Eigen::ArrayXXd squares = deviations.square();
+        Eigen::MatrixXd weighted = (deviations.rowwise() * weights.transpose().array()).matrix();
+        statistic._m11 = deviations.matrix() * weighted.transpose();
+        statistic._m21 = squares.matrix() * weighted.transpose();
+        statistic._m22 = squares.matrix() * (squares.rowwise() * weights.transpose().array()).matrix().transpose();
+        statistic._m31 = (squares * deviations).matrix() * weighted.transpose();
+        merge(statistic);
+    }
+
+    void MultivariateCoMomentStatistic::shift(const Eigen::VectorXd& offset)
+    {
+        Index size = offset.size();
+        Eigen::ArrayXXd a = offset.replicate(1, size), b = offset.transpose().replicate(size, 1);
+        Eigen::ArrayXXd m2i = _m11.diagonal().replicate(1, size), m2j = _m11.diagonal().transpose().replicate(size, 1), m3i = _m21.diagonal().replicate(1, size);
+        _m31 = (_m31.array() + b * m3i + 3. * a * _m21.array() + 3. * a * b * m2i + 3. * a.square() * _m11.array() + _total * a.cube() * b).matrix();
+        _m22 = (_m22.array() + 2. * b * _m21.array() + 2. * a * _m21.transpose().array() + 4. * a * b * _m11.array() + b.square() * m2i + a.square() * m2j + _total * a.square() * b.square()).matrix();
+        _m21 = (_m21.array() + 2. * a * _m11.array() + b * m2i + _total * a.square() * b).matrix();
+        _m11 = (_m11.array() + _total * a * b).matrix();
+    }
+
+    CovarianceMatrixEstimation::CovarianceMatrixEstimation(const Eigen::VectorXd& mean)
+    { _mean = mean; }
+
+    CovarianceMatrixEstimation::CovarianceMatrixEstimation(const CovarianceMatrixEstimation& estimation)
+    { _mean = estimation._mean; }
+
+    const Eigen::VectorXd& CovarianceMatrixEstimation::get_mean() const
+    { return _mean; }
+
+    NaturalCovarianceMatrixEstimation::NaturalCovarianceMatrixEstimation(const Eigen::VectorXd& mean, const Eigen::MatrixXd& covariance, const bool& bias) : CovarianceMatrixEstimation(mean)
+    { 
+        _covariance = covariance;
+        _bias = bias;
+    }
+
+    NaturalCovarianceMatrixEstimation::NaturalCovarianceMatrixEstimation(const NaturalCovarianceMatrixEstimation& estimation) : CovarianceMatrixEstimation(estimation)
+    {
+        _covariance = estimation._covariance;
+        _bias = estimation._bias;
+    }
+
+    const bool& NaturalCovarianceMatrixEstimation::get_bias() const
+    { return _bias; }
+
+    const Eigen::MatrixXd& NaturalCovarianceMatrixEstimation::get_covariance() const
+    { return _covariance; }
+
+    NaturalCovarianceMatrixEstimation::Estimator::Estimator()
+    {
+        _bias = false;
+        _block = 256;
+    }
+
+    NaturalCovarianceMatrixEstimation::Estimator::Estimator(const bool& bias)
+    {
+        _bias = bias;
+        _block = 256;
+    }
+
+    NaturalCovarianceMatrixEstimation::Estimator::Estimator(const Estimator& estimator)
+    {
+        _bias = estimator._bias;
+        _block = estimator._block;
+    }
+
+    std::unique_ptr< CovarianceMatrixEstimation > NaturalCovarianceMatrixEstimation::Estimator::operator() (const MultivariateData& data, const Eigen::VectorXd& mean) const
+    {
+        const MultivariateSampleSpace* sample_space = data.get_sample_space();
+        std::vector< Index > components;
+        std::vector< outcome_type > outcomes;
+        for(Index index = 0, max_index = mean.size(); index < max_index; ++index)
+        {
+            outcome_type outcome = sample_space->get(index)->get_outcome();
+            if(outcome != CATEGORICAL)
+            {
+                components.push_back(index);
+                outcomes.push_back(outcome);
+            }
+        }
+        Index size = components.size(), rows = 0;
+        Eigen::MatrixXd values = Eigen::MatrixXd::Zero(size, _block), masks = Eigen::MatrixXd::Zero(size, _block), squares = Eigen::MatrixXd::Zero(size, _block);
+        Eigen::MatrixXd products = Eigen::MatrixXd::Zero(size, size), totals = Eigen::MatrixXd::Zero(size, size), totals_square = Eigen::MatrixXd::Zero(size, size);
+        double total = 0., total_square = 0., block_total = 0., block_total_square = 0.;
+        bool complete = true;
+        std::unique_ptr< MultivariateData::Generator > generator = data.generator();
+        while(generator->is_valid() || rows > 0)
+        {
+            if(generator->is_valid())
+            {
+                double weight = generator->weight(), root = sqrt(weight);
+                const MultivariateEvent* event = generator->event();
+                for(Index index = 0; index < size; ++index)
+                {
+                    const UnivariateEvent* component = event ? event->get(components[index]) : nullptr;
+                    if(component && component->get_event() == ELEMENTARY)
+                    {
+                        double value;
+                        if(outcomes[index] == DISCRETE)
+                        { value = static_cast< const DiscreteElementaryEvent* >(component)->get_value(); }
+                        else
+                        { value = static_cast< const ContinuousElementaryEvent* >(component)->get_value(); }
+                        values(index, rows) = root * (value - mean(components[index]));
+                        masks(index, rows) = root;
+                        squares(index, rows) = weight;
+                    }
+                    else
+                    {
+                        values(index, rows) = 0.;
+                        masks(index, rows) = 0.;
+                        squares(index, rows) = 0.;
+                        complete = false;
+                    }
+                }
+                block_total += weight;
+                block_total_square += pow(weight, 2);
+                ++rows;
+                ++(*generator);
+            }
+            if(rows == _block || (!generator->is_valid() && rows > 0))
+            {
+                products.selfadjointView< Eigen::Lower >().rankUpdate(values.leftCols(rows));
+                if(complete)
+                {
+                    total += block_total;
+                    total_square += block_total_square;
+                }
+                else
+                {
+                    totals.selfadjointView< Eigen::Lower >().rankUpdate(masks.leftCols(rows));
+                    totals_square.selfadjointView< Eigen::Lower >().rankUpdate(squares.leftCols(rows));
+                }
+                rows = 0;
+                block_total = 0.;
+                block_total_square = 0.;
+                complete = true;
+            }
+        }
+        Eigen::MatrixXd covariance = Eigen::MatrixXd::Constant(mean.size(), mean.size(), std::numeric_limits< double >::quiet_NaN());
+        for(Index i = 0; i < size; ++i)
+        {
+            for(Index j = 0; j <= i; ++j)
+            {
+                double _total = totals(i, j) + total, _covariance = products(i, j) / _total;
+                if(!_bias)
+                {
+                    _total = pow(_total, 2.);
+                    _covariance *= _total / (_total - totals_square(i, j) - total_square);
+                }
+                covariance(components[i], components[j]) = _covariance;
+                covariance(components[j], components[i]) = _covariance;
+            }
+        }
+        return std::make_unique< NaturalCovarianceMatrixEstimation >(mean, covariance, _bias);
+    }
+
+    std::unique_ptr< CovarianceMatrixEstimation::Estimator > NaturalCovarianceMatrixEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    const bool& NaturalCovarianceMatrixEstimation::Estimator::get_bias() const
+    { return _bias; }
+
+    void NaturalCovarianceMatrixEstimation::Estimator::set_bias(const bool& bias)
+    { _bias = bias; }
+
+    const Index& NaturalCovarianceMatrixEstimation::Estimator::get_block() const
+    { return _block; }
+
+    void NaturalCovarianceMatrixEstimation::Estimator::set_block(const Index& block)
+    {
+        if(block == 0)
+        { throw lower_bound_error("block", 0, 0, true); }
+        _block = block;
+    }
+
+    StreamingMeanEstimation::StreamingMeanEstimation(const UnivariateMomentStatistic& statistic)
+    {
+        _statistic = statistic;
+        if(_statistic.get_total() > 0.)
+        { _mean = _statistic.get_mean(); }
+        else
+        { _mean = std::numeric_limits< double >::quiet_NaN(); }
+    }
+
+    StreamingMeanEstimation::StreamingMeanEstimation(const StreamingMeanEstimation& estimation)
+    {
+        _mean = estimation._mean;
+        _statistic = estimation._statistic;
+    }
+
+    const double& StreamingMeanEstimation::get_mean() const
+    { return _mean; }
+
+    const UnivariateMomentStatistic& StreamingMeanEstimation::get_statistic() const
+    { return _statistic; }
+
+    StreamingMeanEstimation::Estimator::Estimator()
+    {}
+
+    StreamingMeanEstimation::Estimator::Estimator(const Estimator& estimator)
+    {}
+
+    std::unique_ptr< MeanEstimation > StreamingMeanEstimation::Estimator::operator() (const UnivariateData& data) const
+    {
+        UnivariateMomentStatistic statistic = UnivariateMomentStatistic();
+        statistic.update(data);
+        return std::make_unique< StreamingMeanEstimation >(statistic);
+    }
+
+    std::unique_ptr< MeanEstimation::Estimator > StreamingMeanEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    StreamingVarianceEstimation::StreamingVarianceEstimation(const double& mean, const UnivariateMomentStatistic& statistic, const bool& bias) : VarianceEstimation(mean)
+    {
+        _bias = bias;
+        _statistic = statistic;
+        if(_statistic.get_total() > 0.)
+        {
+            double total = _statistic.get_total();
+            _variance = _statistic.get_variance(true) + pow(_statistic.get_mean() - mean, 2);
+            if(!_bias)
+            {
+                total = pow(total, 2);
+                _variance *= total / (total - _statistic.get_total_square());
+            }
+        }
+        else
+        { _variance = std::numeric_limits< double >::quiet_NaN(); }
+    }
+
+    StreamingVarianceEstimation::StreamingVarianceEstimation(const StreamingVarianceEstimation& estimation) : VarianceEstimation(estimation)
+    {
+        _bias = estimation._bias;
+        _variance = estimation._variance;
+        _statistic = estimation._statistic;
+    }
+
+    const bool& StreamingVarianceEstimation::get_bias() const
+    { return _bias; }
+
+    const double& StreamingVarianceEstimation::get_variance() const
+    { return _variance; }
+
+    const UnivariateMomentStatistic& StreamingVarianceEstimation::get_statistic() const
+    { return _statistic; }
+
+    StreamingVarianceEstimation::Estimator::Estimator()
+    { _bias = false; }
+
+    StreamingVarianceEstimation::Estimator::Estimator(const bool& bias)
+    { _bias = bias; }
+
+    StreamingVarianceEstimation::Estimator::Estimator(const Estimator& estimator)
+    { _bias = estimator._bias; }
+
+    std::unique_ptr< VarianceEstimation > StreamingVarianceEstimation::Estimator::operator() (const UnivariateData& data, const double& mean) const
+    {
+        UnivariateMomentStatistic statistic = UnivariateMomentStatistic();
+        statistic.update(data);
+        return std::make_unique< StreamingVarianceEstimation >(mean, statistic, _bias);
+    }
+
+    std::unique_ptr< VarianceEstimation > StreamingVarianceEstimation::Estimator::operator() (const UnivariateData& data) const
+    {
+        UnivariateMomentStatistic statistic = UnivariateMomentStatistic();
+        statistic.update(data);
+        double mean;
+        if(statistic.get_total() > 0.)
+        { mean = statistic.get_mean(); }
+        else
+        { mean = std::numeric_limits< double >::quiet_NaN(); }
+        return std::make_unique< StreamingVarianceEstimation >(mean, statistic, _bias);
+    }
+
+    std::unique_ptr< VarianceEstimation::Estimator > StreamingVarianceEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    const bool& StreamingVarianceEstimation::Estimator::get_bias() const
+    { return _bias; }
+
+    void StreamingVarianceEstimation::Estimator::set_bias(const bool& bias)
+    { _bias = bias; }
+
+    StreamingMeanVectorEstimation::StreamingMeanVectorEstimation(const MultivariateMomentStatistic& statistic)
+    {
+        _statistic = statistic;
+        _mean = _statistic.get_mean();
+    }
+
+    StreamingMeanVectorEstimation::StreamingMeanVectorEstimation(const StreamingMeanVectorEstimation& estimation)
+    {
+        _mean = estimation._mean;
+        _statistic = estimation._statistic;
+    }
+
+    const Eigen::VectorXd& StreamingMeanVectorEstimation::get_mean() const
+    { return _mean; }
+
+    const MultivariateMomentStatistic& StreamingMeanVectorEstimation::get_statistic() const
+    { return _statistic; }
+
+    StreamingMeanVectorEstimation::Estimator::Estimator()
+    {}
+
+    StreamingMeanVectorEstimation::Estimator::Estimator(const Estimator& estimator)
+    {}
+
+    std::unique_ptr< MeanVectorEstimation > StreamingMeanVectorEstimation::Estimator::operator() (const MultivariateData& data) const
+    {
+        MultivariateMomentStatistic statistic = MultivariateMomentStatistic();
+        statistic.update(data);
+        std::unique_ptr< StreamingMeanVectorEstimation > estimation = std::make_unique< StreamingMeanVectorEstimation >(statistic);
+        if(statistic.get_total() == 0.)
+        { estimation->_mean = Eigen::VectorXd::Constant(data.get_sample_space()->size(), std::numeric_limits< double >::quiet_NaN()); }
+        return estimation;
+    }
+
+    std::unique_ptr< MeanVectorEstimation::Estimator > StreamingMeanVectorEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    StreamingCovarianceMatrixEstimation::StreamingCovarianceMatrixEstimation(const Eigen::VectorXd& mean, const MultivariateMomentStatistic& statistic, const bool& bias) : CovarianceMatrixEstimation(mean)
+    {
+        _bias = bias;
+        _statistic = statistic;
+        if(_statistic.get_total() > 0.)
+        {
+            Eigen::VectorXd delta = _statistic.get_mean() - mean;
+            _covariance = _statistic.get_covariance(true) + delta * delta.transpose();
+            if(!_bias)
+            {
+                double total = pow(_statistic.get_total(), 2);
+                _covariance *= total / (total - _statistic.get_total_square());
+            }
+        }
+        else
+        { _covariance = Eigen::MatrixXd::Constant(mean.size(), mean.size(), std::numeric_limits< double >::quiet_NaN()); }
+    }
+
+    StreamingCovarianceMatrixEstimation::StreamingCovarianceMatrixEstimation(const StreamingCovarianceMatrixEstimation& estimation) : CovarianceMatrixEstimation(estimation)
+    {
+        _bias = estimation._bias;
+        _covariance = estimation._covariance;
+        _statistic = estimation._statistic;
+    }
+
+    const bool& StreamingCovarianceMatrixEstimation::get_bias() const
+    { return _bias; }
+
+    const Eigen::MatrixXd& StreamingCovarianceMatrixEstimation::get_covariance() const
+    { return _covariance; }
+
+    const MultivariateMomentStatistic& StreamingCovarianceMatrixEstimation::get_statistic() const
+    { return _statistic; }
+
+    StreamingCovarianceMatrixEstimation::Estimator::Estimator()
+    { _bias = false; }
+
+    StreamingCovarianceMatrixEstimation::Estimator::Estimator(const bool& bias)
+    { _bias = bias; }
+
+    StreamingCovarianceMatrixEstimation::Estimator::Estimator(const Estimator& estimator)
+    { _bias = estimator._bias; }
+
+    std::unique_ptr< CovarianceMatrixEstimation > StreamingCovarianceMatrixEstimation::Estimator::operator() (const MultivariateData& data, const Eigen::VectorXd& mean) const
+    {
+        MultivariateMomentStatistic statistic = MultivariateMomentStatistic();
+        statistic.update(data);
+        return std::make_unique< StreamingCovarianceMatrixEstimation >(mean, statistic, _bias);
+    }
+
+    std::unique_ptr< CovarianceMatrixEstimation > StreamingCovarianceMatrixEstimation::Estimator::operator() (const MultivariateData& data) const
+    {
+        MultivariateMomentStatistic statistic = MultivariateMomentStatistic();
+        statistic.update(data);
+        Eigen::VectorXd mean;
+        if(statistic.get_total() > 0.)
+        { mean = statistic.get_mean(); }
+        else
+        { mean = Eigen::VectorXd::Constant(data.get_sample_space()->size(), std::numeric_limits< double >::quiet_NaN()); }
+        return std::make_unique< StreamingCovarianceMatrixEstimation >(mean, statistic, _bias);
+    }
+
+    std::unique_ptr< CovarianceMatrixEstimation::Estimator > StreamingCovarianceMatrixEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    const bool& StreamingCovarianceMatrixEstimation::Estimator::get_bias() const
+    { return _bias; }
+
+    void StreamingCovarianceMatrixEstimation::Estimator::set_bias(const bool& bias)
+    { _bias = bias; }
+
+    NaturalSkewnessEstimation::NaturalSkewnessEstimation(const double& skewness)
+    { _skewness = skewness; }
+
+    NaturalSkewnessEstimation::NaturalSkewnessEstimation(const NaturalSkewnessEstimation& estimation)
+    { _skewness = estimation._skewness; }
+
+    const double& NaturalSkewnessEstimation::get_skewness() const
+    { return _skewness; }
+
+    NaturalSkewnessEstimation::Estimator::Estimator()
+    {}
+
+    NaturalSkewnessEstimation::Estimator::Estimator(const Estimator& estimator)
+    {}
+
+    std::unique_ptr< SkewnessEstimation > NaturalSkewnessEstimation::Estimator::operator() (const UnivariateData& data) const
+    {
+        UnivariateMomentStatistic statistic = UnivariateMomentStatistic();
+        statistic.update(data);
+        return std::make_unique< NaturalSkewnessEstimation >(statistic.get_central_moment(3) / pow(statistic.get_central_moment(2), 1.5));
+    }
+
+    std::unique_ptr< SkewnessEstimation::Estimator > NaturalSkewnessEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    NaturalKurtosisEstimation::NaturalKurtosisEstimation(const double& kurtosis)
+    { _kurtosis = kurtosis; }
+
+    NaturalKurtosisEstimation::NaturalKurtosisEstimation(const NaturalKurtosisEstimation& estimation)
+    { _kurtosis = estimation._kurtosis; }
+
+    const double& NaturalKurtosisEstimation::get_kurtosis() const
+    { return _kurtosis; }
+
+    NaturalKurtosisEstimation::Estimator::Estimator()
+    {}
+
+    NaturalKurtosisEstimation::Estimator::Estimator(const Estimator& estimator)
+    {}
+
+    std::unique_ptr< KurtosisEstimation > NaturalKurtosisEstimation::Estimator::operator() (const UnivariateData& data) const
+    {
+        UnivariateMomentStatistic statistic = UnivariateMomentStatistic();
+        statistic.update(data);
+        return std::make_unique< NaturalKurtosisEstimation >(statistic.get_central_moment(4) / pow(statistic.get_central_moment(2), 2));
+    }
+
+    std::unique_ptr< KurtosisEstimation::Estimator > NaturalKurtosisEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    NaturalCoSkewnessMatrixEstimation::NaturalCoSkewnessMatrixEstimation(const Eigen::MatrixXd& coskewness)
+    { _coskewness = coskewness; }
+
+    NaturalCoSkewnessMatrixEstimation::NaturalCoSkewnessMatrixEstimation(const NaturalCoSkewnessMatrixEstimation& estimation)
+    { _coskewness = estimation._coskewness; }
+
+    const Eigen::MatrixXd& NaturalCoSkewnessMatrixEstimation::get_coskewness() const
+    { return _coskewness; }
+
+    NaturalCoSkewnessMatrixEstimation::Estimator::Estimator()
+    {}
+
+    NaturalCoSkewnessMatrixEstimation::Estimator::Estimator(const Estimator& estimator)
+    {}
+
+    std::unique_ptr< CoSkewnessMatrixEstimation > NaturalCoSkewnessMatrixEstimation::Estimator::operator() (const MultivariateData& data) const
+    {
+        MultivariateCoMomentStatistic statistic = MultivariateCoMomentStatistic();
+        statistic.update(data);
+        Eigen::MatrixXd coskewness;
+        if(statistic.get_total() > 0.)
+        { coskewness = statistic.get_coskewness(); }
+        else
+        { coskewness = Eigen::MatrixXd::Constant(data.get_sample_space()->size(), data.get_sample_space()->size(), std::numeric_limits< double >::quiet_NaN()); }
+        return std::make_unique< NaturalCoSkewnessMatrixEstimation >(coskewness);
+    }
+
+    std::unique_ptr< CoSkewnessMatrixEstimation::Estimator > NaturalCoSkewnessMatrixEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    NaturalCoKurtosisMatrixEstimation::NaturalCoKurtosisMatrixEstimation(const Eigen::MatrixXd& cokurtosis)
+    { _cokurtosis = cokurtosis; }
+
+    NaturalCoKurtosisMatrixEstimation::NaturalCoKurtosisMatrixEstimation(const NaturalCoKurtosisMatrixEstimation& estimation)
+    { _cokurtosis = estimation._cokurtosis; }
+
+    const Eigen::MatrixXd& NaturalCoKurtosisMatrixEstimation::get_cokurtosis() const
+    { return _cokurtosis; }
+
+    NaturalCoKurtosisMatrixEstimation::Estimator::Estimator()
+    {}
+
+    NaturalCoKurtosisMatrixEstimation::Estimator::Estimator(const Estimator& estimator)
+    {}
+
+    std::unique_ptr< CoKurtosisMatrixEstimation > NaturalCoKurtosisMatrixEstimation::Estimator::operator() (const MultivariateData& data) const
+    {
+        MultivariateCoMomentStatistic statistic = MultivariateCoMomentStatistic();
+        statistic.update(data);
+        Eigen::MatrixXd cokurtosis;
+        if(statistic.get_total() > 0.)
+        { cokurtosis = statistic.get_cokurtosis(); }
+        else
+        { cokurtosis = Eigen::MatrixXd::Constant(data.get_sample_space()->size(), data.get_sample_space()->size(), std::numeric_limits< double >::quiet_NaN()); }
+        return std::make_unique< NaturalCoKurtosisMatrixEstimation >(cokurtosis);
+    }
+
+    std::unique_ptr< CoKurtosisMatrixEstimation::Estimator > NaturalCoKurtosisMatrixEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    Eigen::VectorXd QuantileEstimation::get_quantiles(const Eigen::VectorXd& probabilities) const
+    {
+        Eigen::VectorXd quantiles(probabilities.size());
+        for(Index index = 0, max_index = probabilities.size(); index < max_index; ++index)
+        { quantiles[index] = get_quantile(probabilities[index]); }
+        return quantiles;
+    }
+
+    double QuantileEstimation::get_median() const
+    { return get_quantile(.5); }
+
+    NaturalQuantileEstimation::NaturalQuantileEstimation(const std::vector< double >& values, const std::vector< double >& cumulative)
+    {
+        _values = values;
+        _cumulative = cumulative;
+    }
+
+    NaturalQuantileEstimation::NaturalQuantileEstimation(const NaturalQuantileEstimation& estimation)
+    {
+        _values = estimation._values;
+        _cumulative = estimation._cumulative;
+    }
+
+    double NaturalQuantileEstimation::get_quantile(const double& p) const
+    {
+        if(p < 0. || p > 1.)
+        { throw interval_error("p", p, 0., 1., std::make_pair(false, false)); }
+        double quantile;
+        if(_values.size() > 0)
+        {
+            Index index = std::lower_bound(_cumulative.cbegin(), _cumulative.cend(), p * _cumulative.back()) - _cumulative.cbegin();
+            quantile = _values[std::min(index, _values.size() - 1)];
+        }
+        else
+        { quantile = std::numeric_limits< double >::quiet_NaN(); }
+        return quantile;
+    }
+
+    NaturalQuantileEstimation::Estimator::Estimator()
+    {}
+
+    NaturalQuantileEstimation::Estimator::Estimator(const Estimator& estimator)
+    {}
+
+    std::unique_ptr< QuantileEstimation > NaturalQuantileEstimation::Estimator::operator() (const UnivariateData& data) const
+    {
+        std::vector< std::pair< double, double > > table;
+        __impl::observations(data, table);
+        std::sort(table.begin(), table.end());
+        std::vector< double > values(table.size()), cumulative(table.size());
+        double total = 0.;
+        for(Index index = 0, max_index = table.size(); index < max_index; ++index)
+        {
+            total += table[index].second;
+            values[index] = table[index].first;
+            cumulative[index] = total;
+        }
+        return std::make_unique< NaturalQuantileEstimation >(values, cumulative);
+    }
+
+    std::unique_ptr< QuantileEstimation::Estimator > NaturalQuantileEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    SelectionQuantileEstimation::SelectionQuantileEstimation(const Eigen::VectorXd& probabilities, const Eigen::VectorXd& quantiles)
+    {
+        _probabilities = probabilities;
+        _quantiles = quantiles;
+    }
+
+    SelectionQuantileEstimation::SelectionQuantileEstimation(const SelectionQuantileEstimation& estimation)
+    {
+        _probabilities = estimation._probabilities;
+        _quantiles = estimation._quantiles;
+    }
+
+    double SelectionQuantileEstimation::get_quantile(const double& p) const
+    {
+        Index index = 0, max_index = _probabilities.size();
+        while(index < max_index && fabs(_probabilities[index] - p) > 1e-12)
+        { ++index; }
+        if(index == max_index)
+        { throw parameter_error("p", "the quantile of this probability was not selected by the estimator"); }
+        return _quantiles[index];
+    }
+
+    const Eigen::VectorXd& SelectionQuantileEstimation::get_probabilities() const
+    { return _probabilities; }
+
+    SelectionQuantileEstimation::Estimator::Estimator()
+    { _probabilities = Eigen::VectorXd::Constant(1, .5); }
+
+    SelectionQuantileEstimation::Estimator::Estimator(const Eigen::VectorXd& probabilities)
+    { set_probabilities(probabilities); }
+
+    SelectionQuantileEstimation::Estimator::Estimator(const Estimator& estimator)
+    { _probabilities = estimator._probabilities; }
+
+    std::unique_ptr< QuantileEstimation > SelectionQuantileEstimation::Estimator::operator() (const UnivariateData& data) const
+    {
+        std::vector< std::pair< double, double > > table;
+        __impl::observations(data, table);
+        Eigen::VectorXd quantiles = Eigen::VectorXd::Constant(_probabilities.size(), std::numeric_limits< double >::quiet_NaN());
+        if(table.size() > 0)
+        {
+            double total = 0.;
+            for(Index index = 0, max_index = table.size(); index < max_index; ++index)
+            { total += table[index].second; }
+            std::vector< Index > order(_probabilities.size());
+            for(Index index = 0, max_index = order.size(); index < max_index; ++index)
+            { order[index] = index; }
+            std::sort(order.begin(), order.end(), [this](const Index& lhs, const Index& rhs) { return _probabilities[lhs] < _probabilities[rhs]; });
+            std::vector< double > targets(order.size()), selected(order.size());
+            for(Index index = 0, max_index = order.size(); index < max_index; ++index)
+            { targets[index] = _probabilities[order[index]] * total; }
+            __impl::select(table.begin(), table.end(), targets, 0, targets.size(), 0., selected);
+            for(Index index = 0, max_index = order.size(); index < max_index; ++index)
+            { quantiles[order[index]] = selected[index]; }
+        }
+        return std::make_unique< SelectionQuantileEstimation >(_probabilities, quantiles);
+    }
+
+    std::unique_ptr< QuantileEstimation::Estimator > SelectionQuantileEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    const Eigen::VectorXd& SelectionQuantileEstimation::Estimator::get_probabilities() const
+    { return _probabilities; }
+
+    void SelectionQuantileEstimation::Estimator::set_probabilities(const Eigen::VectorXd& probabilities)
+    {
+        for(Index index = 0, max_index = probabilities.size(); index < max_index; ++index)
+        {
+            if(probabilities[index] < 0. || probabilities[index] > 1.)
+            { throw interval_error("probabilities", probabilities[index], 0., 1., std::make_pair(false, false)); }
+        }
+        _probabilities = probabilities;
+    }
+
+    UnivariateQuantileStatistic::UnivariateQuantileStatistic()
+    {
+        _compression = 100.;
+        reset();
+    }
+
+    UnivariateQuantileStatistic::UnivariateQuantileStatistic(const double& compression)
+    {
+        if(compression <= 0.)
+        { throw lower_bound_error("compression", compression, 0., true); }
+        _compression = compression;
+        reset();
+    }
+
+    UnivariateQuantileStatistic::UnivariateQuantileStatistic(const UnivariateQuantileStatistic& statistic)
+    {
+        _compression = statistic._compression;
+        _total = statistic._total;
+        _minimum = statistic._minimum;
+        _maximum = statistic._maximum;
+        _centroids = statistic._centroids;
+        _buffer = statistic._buffer;
+    }
+
+    UnivariateQuantileStatistic::~UnivariateQuantileStatistic()
+    {}
+
+    UnivariateQuantileStatistic& UnivariateQuantileStatistic::operator=(const UnivariateQuantileStatistic& statistic)
+    {
+        _compression = statistic._compression;
+        _total = statistic._total;
+        _minimum = statistic._minimum;
+        _maximum = statistic._maximum;
+        _centroids = statistic._centroids;
+        _buffer = statistic._buffer;
+        return *this;
+    }
+
+    void UnivariateQuantileStatistic::update(const UnivariateEvent* event, const double& weight)
+    {
+        if(event && event->get_event() == ELEMENTARY && weight > 0.)
+        {
+            switch(event->get_outcome())
+            {
+                case DISCRETE:
+                    accumulate(static_cast< const DiscreteElementaryEvent* >(event)->get_value(), weight);
+                    break;
+                case CONTINUOUS:
+                    accumulate(static_cast< const ContinuousElementaryEvent* >(event)->get_value(), weight);
+                    break;
+                default:
+                    throw qualitative_sample_space_error();
+                    break;
+            }
+        }
+    }
+
+    void UnivariateQuantileStatistic::update(const UnivariateData& data)
+    {
+        std::unique_ptr< UnivariateData::Generator > generator = data.generator();
+        while(generator->is_valid())
+        {
+            update(generator->event(), generator->weight());
+            ++(*generator);
+        }
+    }
+
+    void UnivariateQuantileStatistic::merge(const UnivariateQuantileStatistic& statistic)
+    {
+        _buffer.insert(_buffer.end(), statistic._centroids.cbegin(), statistic._centroids.cend());
+        _buffer.insert(_buffer.end(), statistic._buffer.cbegin(), statistic._buffer.cend());
+        _total += statistic._total;
+        _minimum = std::min(_minimum, statistic._minimum);
+        _maximum = std::max(_maximum, statistic._maximum);
+        compress();
+    }
+
+    void UnivariateQuantileStatistic::reset()
+    {
+        _total = 0.;
+        _minimum = std::numeric_limits< double >::infinity();
+        _maximum = -std::numeric_limits< double >::infinity();
+        _centroids.clear();
+        _buffer.clear();
+    }
+
+    const double& UnivariateQuantileStatistic::get_total() const
+    { return _total; }
+
+    double UnivariateQuantileStatistic::get_quantile(const double& p) const
+    {
+        if(p < 0. || p > 1.)
+        { throw interval_error("p", p, 0., 1., std::make_pair(false, false)); }
+        double quantile;
+        if(_buffer.size() > 0)
+        {
+            UnivariateQuantileStatistic statistic = *this;
+            statistic.compress();
+            quantile = statistic.get_quantile(p);
+        }
+        else if(_centroids.size() == 0)
+        { quantile = std::numeric_limits< double >::quiet_NaN(); }
+        else
+        {
+            // Linear interpolation between centroid centers, the extreme values being attained at null and total cumulative weights
+            double target = p * _total, cumulative = 0., center = 0., mean = _minimum;
+            Index index = 0, max_index = _centroids.size();
+            while(index < max_index && cumulative + _centroids[index].second / 2. < target)
+            {
+                center = cumulative + _centroids[index].second / 2.;
+                mean = _centroids[index].first;
+                cumulative += _centroids[index].second;
+                ++index;
+            }
+            double next_center, next_mean;
+            if(index < max_index)
+            {
+                next_center = cumulative + _centroids[index].second / 2.;
+                next_mean = _centroids[index].first;
+            }
+            else
+            {
+                next_center = _total;
+                next_mean = _maximum;
+            }
+            if(next_center > center)
+            { quantile = mean + (next_mean - mean) * (target - center) / (next_center - center); }
+            else
+            { quantile = next_mean; }
+        }
+        return quantile;
+    }
+
+    const double& UnivariateQuantileStatistic::get_minimum() const
+    { return _minimum; }
+
+    const double& UnivariateQuantileStatistic::get_maximum() const
+    { return _maximum; }
+
+    Index UnivariateQuantileStatistic::get_nb_centroids() const
+    {
+        Index nb_centroids;
+        if(_buffer.size() > 0)
+        {
+            UnivariateQuantileStatistic statistic = *this;
+            statistic.compress();
+            nb_centroids = statistic._centroids.size();
+        }
+        else
+        { nb_centroids = _centroids.size(); }
+        return nb_centroids;
+    }
+
+    const double& UnivariateQuantileStatistic::get_compression() const
+    { return _compression; }
+
+    void UnivariateQuantileStatistic::accumulate(const double& value, const double& weight)
+    {
+        _buffer.push_back(std::make_pair(value, weight));
+        _total += weight;
+        _minimum = std::min(_minimum, value);
+        _maximum = std::max(_maximum, value);
+        if(_buffer.size() >= 5 * _compression)
+        { compress(); }
+    }
+
+    void UnivariateQuantileStatistic::compress()
+    {
+        if(_buffer.size() > 0)
+        {
+            _buffer.insert(_buffer.end(), _centroids.cbegin(), _centroids.cend());
+            std::sort(_buffer.begin(), _buffer.end());
+            double total = 0.;
+            for(Index index = 0, max_index = _buffer.size(); index < max_index; ++index)
+            { total += _buffer[index].second; }
+            // Arcsine scale function k(q) and its inverse, a centroid spanning at most one unit of k
+            double pi = boost::math::constants::pi< double >();
+            auto limit = [&](const double& cumulative) -> double
+            {
+                double k = _compression * asin(2. * std::min(cumulative / total, 1.) - 1.) / (2. * pi) + 1.;
+                return total * (sin(std::min(2. * pi * k / _compression, pi / 2.)) + 1.) / 2.;
+            };
+            _centroids.clear();
+            std::pair< double, double > current = _buffer[0];
+            double cumulative = 0., bound = limit(0.);
+            for(Index index = 1, max_index = _buffer.size(); index < max_index; ++index)
+            {
+                if(cumulative + current.second + _buffer[index].second <= bound)
+                {
+                    current.second += _buffer[index].second;
+                    current.first += (_buffer[index].first - current.first) * _buffer[index].second / current.second;
+                }
+                else
+                {
+                    cumulative += current.second;
+                    _centroids.push_back(current);
+                    bound = limit(cumulative);
+                    current = _buffer[index];
+                }
+            }
+            _centroids.push_back(current);
+            _buffer.clear();
+        }
+    }
+
+    StreamingQuantileEstimation::StreamingQuantileEstimation(const UnivariateQuantileStatistic& statistic)
+    { _statistic = statistic; }
+
+    StreamingQuantileEstimation::StreamingQuantileEstimation(const StreamingQuantileEstimation& estimation)
+    { _statistic = estimation._statistic; }
+
+    double StreamingQuantileEstimation::get_quantile(const double& p) const
+    { return _statistic.get_quantile(p); }
+
+    const UnivariateQuantileStatistic& StreamingQuantileEstimation::get_statistic() const
+    { return _statistic; }
+
+    StreamingQuantileEstimation::Estimator::Estimator()
+    { _compression = 100.; }
+
+    StreamingQuantileEstimation::Estimator::Estimator(const double& compression)
+    { set_compression(compression); }
+
+    StreamingQuantileEstimation::Estimator::Estimator(const Estimator& estimator)
+    { _compression = estimator._compression; }
+
+    std::unique_ptr< QuantileEstimation > StreamingQuantileEstimation::Estimator::operator() (const UnivariateData& data) const
+    {
+        UnivariateQuantileStatistic statistic = UnivariateQuantileStatistic(_compression);
+        statistic.update(data);
+        statistic.compress();
+        return std::make_unique< StreamingQuantileEstimation >(statistic);
+    }
+
+    std::unique_ptr< QuantileEstimation::Estimator > StreamingQuantileEstimation::Estimator::copy() const
+    { return std::make_unique< Estimator >(*this); }
+
+    const double& StreamingQuantileEstimation::Estimator::get_compression() const
+    { return _compression; }
+
+    void StreamingQuantileEstimation::Estimator::set_compression(const double& compression)
+    {
+        if(compression <= 0.)
+        { throw lower_bound_error("compression", compression, 0., true); }
+        _compression = compression;
+    }
+
+    /*CoVarianceEstimation::CoVarianceEstimation(const std::array< double, 2 >& means)
+    { _means = means; }
+
+    CoVarianceEstimation::CoVarianceEstimation(const CoVarianceEstimation& estimation)
+    { _means = estimation._means; }
+
+    const std::array< double, 2 >& CoVarianceEstimation::get_means() const
+    { return _means; }
+    
+    std::unique_ptr< CoVarianceEstimation > CoVarianceEstimation::Estimator::operator() (const UnivariateData& data) const
+    {
+        NaturalMeanEstimation::Estimator estimator = NaturalMeanEstimation::Estimator();
+        std::unique_ptr< MeanEstimation > estimation = estimator(data);
+        double mean = estimation->get_mean();
+        return operator() (data, mean);
+    }
+
+    std::unique_ptr< CoVarianceEstimation > CoVarianceEstimation::Estimator::operator() (const UnivariateData& data, const double& mean) const
+    {
+        std::unique_ptr< MultivariateDataFrame > datas = std::make_unique< MultivariateDataFrame >();
+        datas->append_component(data);
+        datas->append_component(data);
+        std::array< double, 2 > means{ {mean, mean} };
+        return operator() (0, 1, datas, means);
+    }
+
+    std::unique_ptr< CoVarianceEstimation > CoVarianceEstimation::Estimator::operator() (const Index& i, const Index& j, const std::unique_ptr< MultivariateDataFrame > data) const
+    {
+        NaturalMeanEstimation::Estimator estimator = NaturalMeanEstimation::Estimator();
+        std::unique_ptr< MeanEstimation > estimation_i = estimator(data.get_component(i));
+        std::unique_ptr< MeanEstimation > estimation_j = estimator(data.get_component(j));
+        std::array< double, 2 > means{ {estimation_i->get_mean(), estimation_j->get_mean()} };
+        return operator() (i, j, data, means);
+    }
+
+    NaturalCoVarianceEstimation::NaturalCoVarianceEstimation(const std::array< double, 2 >& means, const double& covariance, const bool& bias) : CoVarianceEstimation(means)
+    {
+        _covariance = covariance;
+        _bias = bias;
+    }
+
+    NaturalCoVarianceEstimation::NaturalCoVarianceEstimation(const NaturalCoVarianceEstimation& estimation) : CoVarianceEstimation(estimation)
+    {
+        _covariance = estimation._covariance;
+        _bias = estimation._bias;
+    }
+
+    const bool& NaturalCoVarianceEstimation::get_bias() const
+    { return _bias; }
+
+    const double& NaturalCoVarianceEstimation::get_covariance() const
+    { return _covariance; }
+
+    NaturalCoVarianceEstimation::Estimator::Estimator(const bool& bias)
+    { _bias = bias; }
+
+    NaturalCoVarianceEstimation::Estimator::Estimator(const Estimator& estimator)
+    { _bias = estimator._bias; }
+
+    std::unique_ptr< CoVarianceEstimation > NaturalCoVarianceEstimation::Estimator::operator() (const Index& i, const Index& j, const std::unique_ptr< MultivariateDataFrame > data, const std::array< double, 2 >& means) const
+    {
+        if(!data)
+        { throw std::runtime_error("None"); }
+        if(!*data)
+        { throw std::runtime_error("invalid"); }
+        double total = data.compute_total(), covariance;
+        if(total > 0 && data.size() > 0 && boost::math::isfinite(means.at(0) + means.at(1)))
+        {
+            Index index = 0, max_index = data.size();
+            double total_square = 0;
+            const UnivariateData&& data_i = data.get_component(i), data_j = data.get_component(j);
+            switch(data_i->get_sample_space()->get_outcome())
+            {
+                case CATEGORICAL:
+                    covariance = std::numeric_limits< double >::quiet_NaN();
+                    break;
+                case DISCRETE:
+                    switch(data_j->get_sample_space()->get_outcome())
+                    {
+                        case CATEGORICAL:
+                            covariance = std::numeric_limits< double >::quiet_NaN();
+                            break;
+                        case DISCRETE:
                             covariance = 0.;
                             while(boost::math::isfinite(covariance) && index < max_index)
                             {
@@ -559,610 +1883,5 @@ namespace statiskit
     { return _bias; }
 
     void NaturalCoVarianceEstimation::Estimator::set_bias(const bool& bias)
-    { _bias = bias; }
-
-    /*double MomentEstimator::operator() (const std::array< const UnivariateData*, 3 >& df) const
-    {
-        std::array< double, 3 > mean{ {(*this)(df.at(0), na_omit),
-                                       (*this)(df.at(1), na_omit),
-                                       (*this)(df.at(2), na_omit)} };
-        return (*this)(df, mean, na_omit);
-    }
-
-    double MomentEstimator::operator() (const std::array< const UnivariateData*, 3 >& df, const std::array< double, 3 >& mean) const
-    {
-        std::array< double, 3 > stderror{ {(*this)(std::array< const UnivariateData*, 2 >{ {df.at(0), df.at(0)} }, std::array< double, 2 >{ {mean.at(0), mean.at(0)} }, na_omit),
-                                           (*this)(std::array< const UnivariateData*, 2 >{ {df.at(1), df.at(1)} }, std::array< double, 2 >{ {mean.at(1), mean.at(1)} }, na_omit),
-                                           (*this)(std::array< const UnivariateData*, 2 >{ {df.at(2), df.at(2)} }, std::array< double, 2 >{ {mean.at(2), mean.at(2)} }, na_omit)} };
-        stderror.at(0) = sqrt(stderror.at(0));
-        stderror.at(1) = sqrt(stderror.at(1));
-        stderror.at(2) = sqrt(stderror.at(2));
-        return (*this)(df, mean, stderror, na_omit);
-    }
-
-    double MomentEstimator::operator() (const std::array< const UnivariateData*, 4 >& df) const
-    {
-        std::array< double, 4 > mean{ {(*this)(df.at(0), na_omit),
-                                       (*this)(df.at(1), na_omit),
-                                       (*this)(df.at(2), na_omit),
-                                       (*this)(df.at(3), na_omit)} };
-        return (*this)(df, mean, na_omit);
-    }
-
-    double MomentEstimator::operator() (const std::array< const UnivariateData*, 4 >& df, const std::array< double, 4 >& mean) const
-    {
-        std::array< double, 4 > stderror{ {(*this)(std::array< const UnivariateData*, 2 >{ {df.at(0), df.at(0)} }, std::array< double, 2 >{ {mean.at(0), mean.at(0)} }, na_omit),
-                                           (*this)(std::array< const UnivariateData*, 2 >{ {df.at(1), df.at(1)} }, std::array< double, 2 >{ {mean.at(1), mean.at(1)} }, na_omit),
-                                           (*this)(std::array< const UnivariateData*, 2 >{ {df.at(2), df.at(2)} }, std::array< double, 2 >{ {mean.at(2), mean.at(2)} }, na_omit),
-                                           (*this)(std::array< const UnivariateData*, 2 >{ {df.at(3), df.at(3)} }, std::array< double, 2 >{ {mean.at(3), mean.at(3)} }, na_omit)} };
-        stderror.at(0) = sqrt(stderror.at(0));
-        stderror.at(1) = sqrt(stderror.at(1));
-        stderror.at(2) = sqrt(stderror.at(2));
-        stderror.at(3) = sqrt(stderror.at(3));
-        return (*this)(df, mean, stderror, na_omit);
-    }
-
-    NaturalMomentEstimator::NaturalMomentEstimator(const bool& biased)
-    { _biased = biased; }
-
-    NaturalMomentEstimator::NaturalMomentEstimator(const NaturalMomentEstimator& estimator)
-    { _biased = estimator._biased; }
-
-    NaturalMomentEstimator::~NaturalMomentEstimator()
-    {}
-
-    double NaturalMomentEstimator::operator() (const UnivariateData* df) const
-    {
-        double total;
-        if(df && df->get_sample_space()->get_outcome() != CATEGORICAL)
-        { total = df->compute_total(na_omit); }
-        else
-        { total = std::numeric_limits< double >::quiet_NaN(); }
-        double mean;
-        if(boost::math::isfinite(total))
-        {
-            mean = 0.;
-            switch(df->get_sample_space()->get_outcome())
-            {
-                case DISCRETE:
-                    for(Index index = 0, max_index = df->size(); index < max_index; ++index)
-                    { mean += get_value< DiscreteEvent >(df, index, na_omit)/total; }
-                    break;
-                case CONTINUOUS:
-                    for(Index index = 0, max_index = df->size(); index < max_index; ++index)
-                    { mean += get_value< ContinuousEvent >(df, index, na_omit)/total; }
-                    break;
-                default:
-                    mean = std::numeric_limits< double >::quiet_NaN();
-                    break;
-            }
-        }
-        else
-        { mean = total; }
-        return mean;
-    }
-
-    double NaturalMomentEstimator::operator() (const std::array< const UnivariateData*, 2 >& df, const std::array< double, 2 >& mean) const
-    {
-        double total;
-        if(df.at(0) && df.at(1) && df.at(0)->get_sample_space()->get_outcome() != CATEGORICAL && df.at(1)->get_sample_space()->get_outcome() != CATEGORICAL && df.at(0)->size() == df.at(1)->size())
-        { total = std::min(df.at(0)->compute_total(na_omit), df.at(1)->compute_total(na_omit)); }
-        else
-        { total = std::numeric_limits< double >::quiet_NaN(); }
-        double covariance;
-        if(boost::math::isfinite(total))
-        {
-            covariance = 0.;
-            Index index = 0;
-            std::array< Index, 2 > max_index{ {df.at(0)->size(), df.at(1)->size()} };
-            switch(df.at(0)->get_sample_space()->get_outcome())
-            {
-                case DISCRETE:
-                    switch(df.at(1)->get_sample_space()->get_outcome())
-                    {
-                        case DISCRETE:
-                            while(index < max_index.at(0) || index < max_index.at(1))
-                            {
-                                covariance += (get_value< DiscreteEvent >(df.at(0), index, mean[0], na_omit)-mean[0]) *
-                                    (get_value< DiscreteEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/total;
-                                ++index;
-                            }
-                            break;
-                        case CONTINUOUS:
-                            while(index < max_index.at(0) || index < max_index.at(1))
-                            {
-                                covariance += (get_value< DiscreteEvent >(df.at(0), index, mean[0], na_omit)-mean[0]) * 
-                                    (get_value< ContinuousEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/total;
-                                ++index;
-                            }
-                            break;
-                        default:
-                            covariance = std::numeric_limits< double >::quiet_NaN();
-                            break;
-                    }
-                    break;
-                case CONTINUOUS:
-                    switch(df.at(1)->get_sample_space()->get_outcome())
-                    {
-                        case DISCRETE:
-                            while(index < max_index.at(0) || index < max_index.at(1))
-                            {
-                                covariance += (get_value< ContinuousEvent >(df.at(0), index, mean[0], na_omit)-mean[0]) *
-                                    (get_value< DiscreteEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/total;
-                                ++index;
-                            }
-                            break;
-                        case CONTINUOUS:
-                            while(index < max_index.at(0) || index < max_index.at(1))
-                            {
-                                covariance += (get_value< ContinuousEvent >(df.at(0), index, mean[0], na_omit)-mean[0]) *
-                                    (get_value< ContinuousEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/total;
-                                ++index;
-                            }
-                            break;
-                        default:
-                            covariance = std::numeric_limits< double >::quiet_NaN();
-                            break;
-                    }
-                    break;
-                default:
-                    covariance = std::numeric_limits< double >::quiet_NaN();
-                    break;
-            }
-            if(boost::math::isfinite(covariance) && !_biased)
-            { covariance *= total/(total-1); }
-        }
-        else
-        { covariance = total; }
-        return covariance;
-    }
-
-    double NaturalMomentEstimator::operator() (const std::array< const UnivariateData*, 3 >& df, const std::array<double, 3>& mean, const std::array<double, 3>& stderror) const
-    {
-        double total;
-        if(df.at(0) && df.at(1) && df.at(2) && df.at(0)->get_sample_space()->get_outcome() != CATEGORICAL && df.at(1)->get_sample_space()->get_outcome() != CATEGORICAL && df.at(2)->get_sample_space()->get_outcome() != CATEGORICAL && df.at(0)->size() == df.at(1)->size() && df.at(1)->size() == df.at(2)->size())
-        { total = std::min(df.at(0)->compute_total(na_omit), std::min(df.at(1)->compute_total(na_omit), df.at(2)->compute_total(na_omit))); }
-        else
-        { total = std::numeric_limits< double >::quiet_NaN(); }
-        double coskewness;
-        if(boost::math::isfinite(total))
-        {
-            coskewness = 0.;
-            Index index = 0;
-            std::array< Index, 3 > max_index{ {df.at(0)->size(), df.at(1)->size(), df.at(2)->size()} };
-            switch(df.at(0)->get_sample_space()->get_outcome())
-            {
-                case DISCRETE:
-                    switch(df.at(1)->get_sample_space()->get_outcome())
-                    {
-                        case DISCRETE:
-                            switch(df.at(2)->get_sample_space()->get_outcome())
-                            {
-                                case DISCRETE:
-                                    while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2))
-                                    {
-                                        coskewness += ((get_value< DiscreteEvent >(df.at(0), index, mean[0], na_omit)-mean[0])/stderror[0] *
-                                                (get_value< DiscreteEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/stderror[1] *
-                                                (get_value< DiscreteEvent >(df.at(2), index, mean[2], na_omit)-mean[2])/stderror[2])/total;
-                                        ++index;
-                                    }
-                                    break;
-                                case CONTINUOUS:
-                                    while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2))
-                                    {
-                                        coskewness += ((get_value< DiscreteEvent >(df.at(0), index, mean[0], na_omit)-mean[0])/stderror[0] *
-                                                (get_value< DiscreteEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/stderror[1] *
-                                                (get_value< ContinuousEvent >(df.at(2), index, mean[2], na_omit)-mean[2])/stderror[2])/total;
-                                        ++index;
-                                    }
-                                    break;
-                                default:
-                                    coskewness = std::numeric_limits< double >::quiet_NaN();
-                                    break;
-                            }
-                            break;
-                        case CONTINUOUS:
-                            switch(df.at(2)->get_sample_space()->get_outcome())
-                            {
-                                case DISCRETE:
-                                    while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2))
-                                    {
-                                        coskewness += ((get_value< DiscreteEvent >(df.at(0), index, mean[0], na_omit)-mean[0])/stderror[0] *
-                                                (get_value< ContinuousEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/stderror[1] *
-                                                (get_value< DiscreteEvent >(df.at(2), index, mean[2], na_omit)-mean[2])/stderror[2])/total;
-                                        ++index;
-                                    }
-                                    break;
-                                case CONTINUOUS:
-                                    while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2))
-                                    {
-                                        coskewness += ((get_value< DiscreteEvent >(df.at(0), index, mean[0], na_omit)-mean[0])/stderror[0] *
-                                                (get_value< ContinuousEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/stderror[1] *
-                                                (get_value< ContinuousEvent >(df.at(2), index, mean[2], na_omit)-mean[2])/stderror[2])/total;
-                                        ++index;
-                                    }
-                                    break;
-                                default:
-                                    coskewness = std::numeric_limits< double >::quiet_NaN();
-                                    break;
-                            }
-                            break;
-                        default:
-                            coskewness = std::numeric_limits< double >::quiet_NaN();
-                            break;
-                    }
-                    break;
-                case CONTINUOUS:
-                    switch(df.at(1)->get_sample_space()->get_outcome())
-                    {
-                        case DISCRETE:
-                            switch(df.at(2)->get_sample_space()->get_outcome())
-                            {
-                                case DISCRETE:
-                                    while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2))
-                                    {
-                                        coskewness += ((get_value< ContinuousEvent >(df.at(0), index, mean[0], na_omit)-mean[0])/stderror[0] *
-                                                (get_value< DiscreteEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/stderror[1] *
-                                                (get_value< DiscreteEvent >(df.at(2), index, mean[2], na_omit)-mean[2])/stderror[2])/total;
-                                        ++index;
-                                    }
-                                    break;
-                                case CONTINUOUS:
-                                    while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2))
-                                    {
-                                        coskewness += ((get_value< ContinuousEvent >(df.at(0), index, mean[0], na_omit)-mean[0])/stderror[0] *
-                                                (get_value< DiscreteEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/stderror[1] *
-                                                (get_value< ContinuousEvent >(df.at(2), index, mean[2], na_omit)-mean[2])/stderror[2])/total;
-                                        ++index;
-                                    }
-                                    break;
-                                default:
-                                    coskewness = std::numeric_limits< double >::quiet_NaN();
-                                    break;
-                            }
-                            break;
-                        case CONTINUOUS:
-                            switch(df.at(2)->get_sample_space()->get_outcome())
-                            {
-                                case DISCRETE:
-                                    while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2))
-                                    {
-                                        coskewness += ((get_value< ContinuousEvent >(df.at(0), index, mean[0], na_omit)-mean[0])/stderror[0] *
-                                                (get_value< ContinuousEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/stderror[1] *
-                                                (get_value< DiscreteEvent >(df.at(2), index, mean[2], na_omit)-mean[2])/stderror[2])/total;
-                                        ++index;
-                                    }
-                                    break;
-                                case CONTINUOUS:
-                                    while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2))
-                                    {
-                                        coskewness += ((get_value< ContinuousEvent >(df.at(0), index, mean[0], na_omit)-mean[0])/stderror[0] *
-                                                (get_value< ContinuousEvent >(df.at(1), index, mean[1], na_omit)-mean[1])/stderror[1] *
-                                                (get_value< ContinuousEvent >(df.at(2), index, mean[2], na_omit)-mean[2])/stderror[2])/total;
-                                        ++index;
-                                    }
-                                    break;
-                                default:
-                                    coskewness = std::numeric_limits< double >::quiet_NaN();
-                                    break;
-                            }
-                            break;
-                        default:
-                            coskewness = std::numeric_limits< double >::quiet_NaN();
-                            break;
-                    }
-                    break;
-                default:
-                    coskewness = std::numeric_limits< double >::quiet_NaN();
-                    break;
-            }
-            if(boost::math::isfinite(coskewness) && !_biased)
-            { coskewness *= total/(total-1)*total/(total-2); }
-        }
-        else
-        { coskewness = total; }
-        return coskewness;
-    }
-
-    double NaturalMomentEstimator::operator() (const std::array< const UnivariateData*, 4 >& df, const std::array<double, 4>& mean, const std::array<double, 4>& stderror) const
-    {
-        double total;
-        if(df.at(0) && df.at(1) && df.at(2) && df.at(3) && df.at(0)->get_sample_space()->get_outcome() != CATEGORICAL && df.at(1)->get_sample_space()->get_outcome() != CATEGORICAL && df.at(2)->get_sample_space()->get_outcome() != CATEGORICAL && df.at(3)->get_sample_space()->get_outcome() != CATEGORICAL && df.at(0)->size() == df.at(1)->size() && df.at(1)->size() == df.at(2)->size() && df.at(2)->size() == df.at(3)->size())
-        { total = std::min(df.at(0)->compute_total(na_omit), std::min(df.at(1)->compute_total(na_omit), std::min(df.at(2)->compute_total(na_omit), df.at(3)->compute_total(na_omit)))); }
-        else
-        { total = std::numeric_limits< double >::quiet_NaN(); }
-        double cokurtosis;
-        if(boost::math::isfinite(total))
-        {
-            cokurtosis = 0.;
-            Index index = 0;
-            std::array< Index, 4 > max_index = { {df.at(0)->size(), df.at(1)->size(), df.at(2)->size(), df.at(3)->size()} };
-            switch(df.at(0)->get_sample_space()->get_outcome())
-            {
-                case DISCRETE:
-                    switch(df.at(1)->get_sample_space()->get_outcome())
-                    {
-                        case DISCRETE:
-                            switch(df.at(2)->get_sample_space()->get_outcome())
-                            {
-                                case DISCRETE:
-                                    switch(df.at(3)->get_sample_space()->get_outcome())
-                                    {
-                                        case DISCRETE:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< DiscreteEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< DiscreteEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< DiscreteEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                            break;
-                                        case CONTINUOUS:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< DiscreteEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< DiscreteEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< ContinuousEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                        default:
-                                            cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                            break;
-                                    }
-                                    break;
-                                case CONTINUOUS:
-                                    switch(df.at(3)->get_sample_space()->get_outcome())
-                                    {
-                                        case DISCRETE:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< DiscreteEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< ContinuousEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< DiscreteEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                            break;
-                                        case CONTINUOUS:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< DiscreteEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< ContinuousEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< ContinuousEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                        default:
-                                            cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                            break;
-                                    }
-                                    break;
-                                default:
-                                    cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                    break;
-                            }
-                            break;
-                        case CONTINUOUS:
-                            switch(df.at(2)->get_sample_space()->get_outcome())
-                            {
-                                case DISCRETE:
-                                    switch(df.at(3)->get_sample_space()->get_outcome())
-                                    {
-                                        case DISCRETE:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< DiscreteEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< DiscreteEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< DiscreteEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                            break;
-                                        case CONTINUOUS:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< DiscreteEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< DiscreteEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< ContinuousEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                        default:
-                                            cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                            break;
-                                    }
-                                    break;
-                                case CONTINUOUS:
-                                    switch(df.at(3)->get_sample_space()->get_outcome())
-                                    {
-                                        case DISCRETE:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< DiscreteEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< ContinuousEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< ContinuousEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< DiscreteEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                            break;
-                                        case CONTINUOUS:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< DiscreteEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< ContinuousEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< ContinuousEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< ContinuousEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                        default:
-                                            cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                            break;
-                                    }
-                                    break;
-                                default:
-                                    cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                    break;
-                            }
-                            break;
-                        default:
-                            cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                            break;
-                    }
-                    break;
-                case CONTINUOUS:
-                    switch(df.at(1)->get_sample_space()->get_outcome())
-                    {
-                        case DISCRETE:
-                            switch(df.at(2)->get_sample_space()->get_outcome())
-                            {
-                                case DISCRETE:
-                                    switch(df.at(3)->get_sample_space()->get_outcome())
-                                    {
-                                        case DISCRETE:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< ContinuousEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< DiscreteEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< DiscreteEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                            break;
-                                        case CONTINUOUS:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< ContinuousEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< DiscreteEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< ContinuousEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                        default:
-                                            cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                            break;
-                                    }
-                                    break;
-                                case CONTINUOUS:
-                                    switch(df.at(3)->get_sample_space()->get_outcome())
-                                    {
-                                        case DISCRETE:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< ContinuousEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< ContinuousEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< DiscreteEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                            break;
-                                        case CONTINUOUS:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< ContinuousEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< ContinuousEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< ContinuousEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                        default:
-                                            cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                            break;
-                                    }
-                                    break;
-                                default:
-                                    cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                    break;
-                            }
-                            break;
-                        case CONTINUOUS:
-                            switch(df.at(2)->get_sample_space()->get_outcome())
-                            {
-                                case DISCRETE:
-                                    switch(df.at(3)->get_sample_space()->get_outcome())
-                                    {
-                                        case DISCRETE:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< ContinuousEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< DiscreteEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< DiscreteEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                            break;
-                                        case CONTINUOUS:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< ContinuousEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< DiscreteEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< DiscreteEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< ContinuousEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                        default:
-                                            cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                            break;
-                                    }
-                                    break;
-                                case CONTINUOUS:
-                                    switch(df.at(3)->get_sample_space()->get_outcome())
-                                    {
-                                        case DISCRETE:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< ContinuousEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< ContinuousEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< ContinuousEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< DiscreteEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                            break;
-                                        case CONTINUOUS:
-                                            while(index < max_index.at(0) || index < max_index.at(1) || index < max_index.at(2) || index < max_index.at(3))
-                                            {
-                                                cokurtosis += ((get_value< ContinuousEvent >(df.at(0)->get_event(index).get(), mean[0], na_omit)-mean[0])/stderror[0] *
-                                                        (get_value< ContinuousEvent >(df.at(1)->get_event(index).get(), mean[1], na_omit)-mean[1])/stderror[1] *
-                                                        (get_value< ContinuousEvent >(df.at(2)->get_event(index).get(), mean[2], na_omit)-mean[2])/stderror[2] *
-                                                        (get_value< ContinuousEvent >(df.at(3)->get_event(index).get(), mean[3], na_omit)-mean[3])/stderror[3])/total;
-                                                ++index;
-                                            }
-                                        default:
-                                            cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                            break;
-                                    }
-                                    break;
-                                default:
-                                    cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                                    break;
-                            }
-                            break;
-                        default:
-                            cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                            break;
-                    }
-                    break;
-                default:
-                    cokurtosis = std::numeric_limits< double >::quiet_NaN();
-                    break;
-            }
-            if(boost::math::isfinite(cokurtosis) && !_biased)
-            {
-                cokurtosis *= total/(total-1)*total/(total-2)*(total+1)/(total-3);
-                cokurtosis -= 3*(total-1)*(total-1)/((total-2)*(total-3));
-            }
-            else
-            { cokurtosis -= 3.; }
-        }
-        else
-        { cokurtosis = total; }
-        return cokurtosis;
-    }
-
-    const bool& NaturalMomentEstimator::get_biased() const
-    { return _biased; }
-
-    std::unique_ptr< MomentEstimator > NaturalMomentEstimator::copy() const
-    { return std::make_unique< NaturalMomentEstimator >(*this); }*/
+    { _bias = bias; }*/
 }
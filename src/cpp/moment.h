@@ -160,6 +160,118 @@ namespace statiskit
             double _variance;
     };
 
+    /** Weighted moments of univariate data up to the fourth order, mergeable across data sets
+     *
+     * Here and below, censored, missing or qualitative events are ignored.
+     */
+    class STATISKIT_CORE_API UnivariateMomentStatistic : public PolymorphicCopy< UnivariateSufficientStatistic, UnivariateMomentStatistic >
+    {
+        public:
+            UnivariateMomentStatistic();
+            UnivariateMomentStatistic(const UnivariateMomentStatistic& statistic);
+            virtual ~UnivariateMomentStatistic();
+
+            UnivariateMomentStatistic& operator=(const UnivariateMomentStatistic& statistic);
+
+            virtual void update(const UnivariateEvent* event, const double& weight);
+            void update(const UnivariateData& data);
+            void merge(const UnivariateMomentStatistic& statistic);
+            virtual void reset();
+
+            const double& get_total() const;
+            const double& get_total_square() const;
+
+            const double& get_mean() const;
+            double get_variance(const bool& bias) const;
+
+            /// Get the weighted central moment of given order (from \f$0\f$ to \f$4\f$)
+            double get_central_moment(const unsigned int& order) const;
+
+            const double& get_minimum() const;
+            const double& get_maximum() const;
+
+        protected:
+            double _total;
+            double _total_square;
+            double _mean;
+            double _m2;
+            double _m3;
+            double _m4;
+            double _minimum;
+            double _maximum;
+
+            void accumulate(const double& value, const double& weight);
+    };
+
+    class STATISKIT_CORE_API MultivariateMomentStatistic : public PolymorphicCopy< MultivariateSufficientStatistic, MultivariateMomentStatistic >
+    {
+        public:
+            MultivariateMomentStatistic();
+            MultivariateMomentStatistic(const MultivariateMomentStatistic& statistic);
+            virtual ~MultivariateMomentStatistic();
+
+            MultivariateMomentStatistic& operator=(const MultivariateMomentStatistic& statistic);
+
+            virtual void update(const MultivariateEvent* event, const double& weight);
+            void update(const MultivariateData& data);
+            void merge(const MultivariateMomentStatistic& statistic);
+            virtual void reset();
+
+            const double& get_total() const;
+            const double& get_total_square() const;
+
+            const Eigen::VectorXd& get_mean() const;
+            Eigen::MatrixXd get_covariance(const bool& bias) const;
+
+        protected:
+            double _total;
+            double _total_square;
+            Eigen::VectorXd _mean;
+            Eigen::MatrixXd _m2;
+
+            void accumulate(const Eigen::Ref< const Eigen::VectorXd >& values, const double& weight);
+    };
+
+    class STATISKIT_CORE_API MultivariateCoMomentStatistic : public PolymorphicCopy< MultivariateSufficientStatistic, MultivariateCoMomentStatistic >
+    {
+        public:
+            MultivariateCoMomentStatistic();
+            MultivariateCoMomentStatistic(const MultivariateCoMomentStatistic& statistic);
+            virtual ~MultivariateCoMomentStatistic();
+
+            MultivariateCoMomentStatistic& operator=(const MultivariateCoMomentStatistic& statistic);
+
+            virtual void update(const MultivariateEvent* event, const double& weight);
+            void update(const MultivariateData& data);
+            void merge(const MultivariateCoMomentStatistic& statistic);
+            virtual void reset();
+
+            const double& get_total() const;
+            const Eigen::VectorXd& get_mean() const;
+
+            /// Get the matrix of weighted central co-moments \f$\mathrm{E}\left(\delta_i^p \delta_j^q\right)\f$ with \f$p, q > 0\f$ and \f$p + q \leq 4\f$
+            Eigen::MatrixXd get_comoment(const unsigned int& p, const unsigned int& q) const;
+
+            Eigen::MatrixXd get_coskewness() const;
+
+            Eigen::MatrixXd get_cokurtosis() const;
+
+            const Index& get_block() const;
+            void set_block(const Index& block);
+
+        protected:
+            double _total;
+            Eigen::VectorXd _mean;
+            Eigen::MatrixXd _m11;
+            Eigen::MatrixXd _m21;
+            Eigen::MatrixXd _m22;
+            Eigen::MatrixXd _m31;
+            Index _block;
+
+            void accumulate(const Eigen::Ref< const Eigen::MatrixXd >& values, const Eigen::Ref< const Eigen::VectorXd >& weights);
+            void shift(const Eigen::VectorXd& offset);
+    };
+
     class STATISKIT_CORE_API NaturalCovarianceMatrixEstimation : public CovarianceMatrixEstimation
     { 
         public:
@@ -184,15 +296,426 @@ namespace statiskit
                     const bool& get_bias() const;
                     void set_bias(const bool& bias);
 
+                    const Index& get_block() const;
+                    void set_block(const Index& block);
+
+                protected:
+                    bool _bias;
+                    Index _block;
+            };
+
+        protected:
+            bool _bias;
+            Eigen::MatrixXd _covariance;
+    };
+
+    class STATISKIT_CORE_API StreamingMeanEstimation : public MeanEstimation
+    {
+        public:
+            StreamingMeanEstimation(const UnivariateMomentStatistic& statistic);
+            StreamingMeanEstimation(const StreamingMeanEstimation& estimation);
+
+            virtual const double& get_mean() const;
+
+            const UnivariateMomentStatistic& get_statistic() const;
+
+            struct STATISKIT_CORE_API Estimator : MeanEstimation::Estimator
+            { 
+                Estimator();
+                Estimator(const Estimator& estimator);
+
+                virtual std::unique_ptr< MeanEstimation > operator() (const UnivariateData& data) const;
+
+                virtual std::unique_ptr< MeanEstimation::Estimator > copy() const;
+            };
+
+        protected:
+            double _mean;
+            UnivariateMomentStatistic _statistic;
+    };
+
+    class STATISKIT_CORE_API StreamingVarianceEstimation : public VarianceEstimation
+    {
+        public:
+            StreamingVarianceEstimation(const double& mean, const UnivariateMomentStatistic& statistic, const bool& bias);
+            StreamingVarianceEstimation(const StreamingVarianceEstimation& estimation);
+
+            const bool& get_bias() const;
+
+            virtual const double& get_variance() const;
+
+            const UnivariateMomentStatistic& get_statistic() const;
+
+            class STATISKIT_CORE_API Estimator : public VarianceEstimation::Estimator
+            {
+                public:
+                    Estimator();
+                    Estimator(const bool& bias);
+                    Estimator(const Estimator& estimator);
+
+                    virtual std::unique_ptr< VarianceEstimation > operator() (const UnivariateData& data, const double& mean) const;
+                    std::unique_ptr< VarianceEstimation > operator() (const UnivariateData& data) const;
+
+                    virtual std::unique_ptr< VarianceEstimation::Estimator > copy() const;
+
+                    const bool& get_bias() const;
+                    void set_bias(const bool& bias);
+
                 protected:
                     bool _bias;
+            };
+
+        protected:
+            bool _bias;
+            double _variance;
+            UnivariateMomentStatistic _statistic;
+    };
+
+    class STATISKIT_CORE_API StreamingMeanVectorEstimation : public MeanVectorEstimation
+    {
+        public:
+            StreamingMeanVectorEstimation(const MultivariateMomentStatistic& statistic);
+            StreamingMeanVectorEstimation(const StreamingMeanVectorEstimation& estimation);
 
-                    double compute(const MultivariateData& data, const Eigen::VectorXd& mean, const Index& i, const Index& j) const;
+            virtual const Eigen::VectorXd& get_mean() const;
+
+            const MultivariateMomentStatistic& get_statistic() const;
+
+            struct STATISKIT_CORE_API Estimator : MeanVectorEstimation::Estimator
+            { 
+                Estimator();
+                Estimator(const Estimator& estimator);
+
+                virtual std::unique_ptr< MeanVectorEstimation > operator() (const MultivariateData& data) const;
+
+                virtual std::unique_ptr< MeanVectorEstimation::Estimator > copy() const;
+            };
+
+        protected:
+            Eigen::VectorXd _mean;
+            MultivariateMomentStatistic _statistic;
+    };
+
+    /** Covariance matrix estimated from a moment statistic, only using fully observed events */
+    class STATISKIT_CORE_API StreamingCovarianceMatrixEstimation : public CovarianceMatrixEstimation
+    {
+        public:
+            StreamingCovarianceMatrixEstimation(const Eigen::VectorXd& mean, const MultivariateMomentStatistic& statistic, const bool& bias);
+            StreamingCovarianceMatrixEstimation(const StreamingCovarianceMatrixEstimation& estimation);
+
+            const bool& get_bias() const;
+
+            virtual const Eigen::MatrixXd& get_covariance() const;
+
+            const MultivariateMomentStatistic& get_statistic() const;
+
+            class STATISKIT_CORE_API Estimator : public CovarianceMatrixEstimation::Estimator
+            {
+                public:
+                    Estimator();
+                    Estimator(const bool& bias);
+                    Estimator(const Estimator& estimator);
+
+                    virtual std::unique_ptr< CovarianceMatrixEstimation > operator() (const MultivariateData& data, const Eigen::VectorXd& mean) const;
+                    std::unique_ptr< CovarianceMatrixEstimation > operator() (const MultivariateData& data) const;
+
+                    virtual std::unique_ptr< CovarianceMatrixEstimation::Estimator > copy() const;
+
+                    const bool& get_bias() const;
+                    void set_bias(const bool& bias);
+
+                protected:
+                    bool _bias;
             };
 
         protected:
             bool _bias;
             Eigen::MatrixXd _covariance;
+            MultivariateMomentStatistic _statistic;
+    };
+
+    struct STATISKIT_CORE_API SkewnessEstimation
+    {
+        virtual const double& get_skewness() const = 0;
+
+        struct STATISKIT_CORE_API Estimator
+        { 
+            virtual std::unique_ptr< SkewnessEstimation > operator() (const UnivariateData& data) const = 0;
+
+            virtual std::unique_ptr< Estimator > copy() const = 0;
+        };
+    };
+
+    struct STATISKIT_CORE_API KurtosisEstimation
+    {
+        virtual const double& get_kurtosis() const = 0;
+
+        struct STATISKIT_CORE_API Estimator
+        { 
+            virtual std::unique_ptr< KurtosisEstimation > operator() (const UnivariateData& data) const = 0;
+
+            virtual std::unique_ptr< Estimator > copy() const = 0;
+        };
+    };
+
+    struct STATISKIT_CORE_API CoSkewnessMatrixEstimation
+    {
+        virtual const Eigen::MatrixXd& get_coskewness() const = 0;
+
+        struct STATISKIT_CORE_API Estimator
+        { 
+            virtual std::unique_ptr< CoSkewnessMatrixEstimation > operator() (const MultivariateData& data) const = 0;
+
+            virtual std::unique_ptr< Estimator > copy() const = 0;
+        };
+    };
+
+    struct STATISKIT_CORE_API CoKurtosisMatrixEstimation
+    {
+        virtual const Eigen::MatrixXd& get_cokurtosis() const = 0;
+
+        struct STATISKIT_CORE_API Estimator
+        { 
+            virtual std::unique_ptr< CoKurtosisMatrixEstimation > operator() (const MultivariateData& data) const = 0;
+
+            virtual std::unique_ptr< Estimator > copy() const = 0;
+        };
+    };
+
+    class STATISKIT_CORE_API NaturalSkewnessEstimation : public SkewnessEstimation
+    {
+        public:
+            NaturalSkewnessEstimation(const double& skewness);
+            NaturalSkewnessEstimation(const NaturalSkewnessEstimation& estimation);
+
+            virtual const double& get_skewness() const;
+
+            struct STATISKIT_CORE_API Estimator : SkewnessEstimation::Estimator
+            { 
+                Estimator();
+                Estimator(const Estimator& estimator);
+
+                virtual std::unique_ptr< SkewnessEstimation > operator() (const UnivariateData& data) const;
+
+                virtual std::unique_ptr< SkewnessEstimation::Estimator > copy() const;
+            };
+
+        protected:
+            double _skewness;
+    };
+
+    class STATISKIT_CORE_API NaturalKurtosisEstimation : public KurtosisEstimation
+    {
+        public:
+            NaturalKurtosisEstimation(const double& kurtosis);
+            NaturalKurtosisEstimation(const NaturalKurtosisEstimation& estimation);
+
+            virtual const double& get_kurtosis() const;
+
+            struct STATISKIT_CORE_API Estimator : KurtosisEstimation::Estimator
+            { 
+                Estimator();
+                Estimator(const Estimator& estimator);
+
+                virtual std::unique_ptr< KurtosisEstimation > operator() (const UnivariateData& data) const;
+
+                virtual std::unique_ptr< KurtosisEstimation::Estimator > copy() const;
+            };
+
+        protected:
+            double _kurtosis;
+    };
+
+    class STATISKIT_CORE_API NaturalCoSkewnessMatrixEstimation : public CoSkewnessMatrixEstimation
+    {
+        public:
+            NaturalCoSkewnessMatrixEstimation(const Eigen::MatrixXd& coskewness);
+            NaturalCoSkewnessMatrixEstimation(const NaturalCoSkewnessMatrixEstimation& estimation);
+
+            virtual const Eigen::MatrixXd& get_coskewness() const;
+
+            struct STATISKIT_CORE_API Estimator : CoSkewnessMatrixEstimation::Estimator
+            { 
+                Estimator();
+                Estimator(const Estimator& estimator);
+
+                virtual std::unique_ptr< CoSkewnessMatrixEstimation > operator() (const MultivariateData& data) const;
+
+                virtual std::unique_ptr< CoSkewnessMatrixEstimation::Estimator > copy() const;
+            };
+
+        protected:
+            Eigen::MatrixXd _coskewness;
+    };
+
+    class STATISKIT_CORE_API NaturalCoKurtosisMatrixEstimation : public CoKurtosisMatrixEstimation
+    {
+        public:
+            NaturalCoKurtosisMatrixEstimation(const Eigen::MatrixXd& cokurtosis);
+            NaturalCoKurtosisMatrixEstimation(const NaturalCoKurtosisMatrixEstimation& estimation);
+
+            virtual const Eigen::MatrixXd& get_cokurtosis() const;
+
+            struct STATISKIT_CORE_API Estimator : CoKurtosisMatrixEstimation::Estimator
+            { 
+                Estimator();
+                Estimator(const Estimator& estimator);
+
+                virtual std::unique_ptr< CoKurtosisMatrixEstimation > operator() (const MultivariateData& data) const;
+
+                virtual std::unique_ptr< CoKurtosisMatrixEstimation::Estimator > copy() const;
+            };
+
+        protected:
+            Eigen::MatrixXd _cokurtosis;
+    };
+
+    /** Weighted quantiles, the quantile of probability p being the smallest value whose cumulative weight reaches p times the total weight */
+    struct STATISKIT_CORE_API QuantileEstimation
+    {
+        virtual double get_quantile(const double& p) const = 0;
+        Eigen::VectorXd get_quantiles(const Eigen::VectorXd& probabilities) const;
+
+        double get_median() const;
+
+        struct STATISKIT_CORE_API Estimator
+        { 
+            virtual std::unique_ptr< QuantileEstimation > operator() (const UnivariateData& data) const = 0;
+
+            virtual std::unique_ptr< Estimator > copy() const = 0;
+        };
+    };
+
+    class STATISKIT_CORE_API NaturalQuantileEstimation : public QuantileEstimation
+    {
+        public:
+            NaturalQuantileEstimation(const std::vector< double >& values, const std::vector< double >& cumulative);
+            NaturalQuantileEstimation(const NaturalQuantileEstimation& estimation);
+
+            virtual double get_quantile(const double& p) const;
+
+            struct STATISKIT_CORE_API Estimator : QuantileEstimation::Estimator
+            { 
+                Estimator();
+                Estimator(const Estimator& estimator);
+
+                virtual std::unique_ptr< QuantileEstimation > operator() (const UnivariateData& data) const;
+
+                virtual std::unique_ptr< QuantileEstimation::Estimator > copy() const;
+            };
+
+        protected:
+            std::vector< double > _values;
+            std::vector< double > _cumulative;
+    };
+
+    /** Quantiles of given probabilities found by recursive selection
+     *
+     * Only the given probabilities, matched up to an absolute tolerance of 1e-12, can be queried.
+     */
+    class STATISKIT_CORE_API SelectionQuantileEstimation : public QuantileEstimation
+    {
+        public:
+            SelectionQuantileEstimation(const Eigen::VectorXd& probabilities, const Eigen::VectorXd& quantiles);
+            SelectionQuantileEstimation(const SelectionQuantileEstimation& estimation);
+
+            virtual double get_quantile(const double& p) const;
+
+            const Eigen::VectorXd& get_probabilities() const;
+
+            class STATISKIT_CORE_API Estimator : public QuantileEstimation::Estimator
+            {
+                public:
+                    Estimator();
+                    Estimator(const Eigen::VectorXd& probabilities);
+                    Estimator(const Estimator& estimator);
+
+                    virtual std::unique_ptr< QuantileEstimation > operator() (const UnivariateData& data) const;
+
+                    virtual std::unique_ptr< QuantileEstimation::Estimator > copy() const;
+
+                    const Eigen::VectorXd& get_probabilities() const;
+                    void set_probabilities(const Eigen::VectorXd& probabilities);
+
+                protected:
+                    Eigen::VectorXd _probabilities;
+            };
+
+        protected:
+            Eigen::VectorXd _probabilities;
+            Eigen::VectorXd _quantiles;
+    };
+
+    /** Approximate weighted quantiles summarized by a merging t-digest */
+    class STATISKIT_CORE_API UnivariateQuantileStatistic : public PolymorphicCopy< UnivariateSufficientStatistic, UnivariateQuantileStatistic >
+    {
+        public:
+            UnivariateQuantileStatistic();
+            UnivariateQuantileStatistic(const double& compression);
+            UnivariateQuantileStatistic(const UnivariateQuantileStatistic& statistic);
+            virtual ~UnivariateQuantileStatistic();
+
+            UnivariateQuantileStatistic& operator=(const UnivariateQuantileStatistic& statistic);
+
+            virtual void update(const UnivariateEvent* event, const double& weight);
+            void update(const UnivariateData& data);
+            void merge(const UnivariateQuantileStatistic& statistic);
+            virtual void reset();
+
+            void compress();
+
+            const double& get_total() const;
+
+            double get_quantile(const double& p) const;
+
+            const double& get_minimum() const;
+            const double& get_maximum() const;
+
+            Index get_nb_centroids() const;
+
+            const double& get_compression() const;
+
+        protected:
+            double _compression;
+            double _total;
+            double _minimum;
+            double _maximum;
+            std::vector< std::pair< double, double > > _centroids;
+            std::vector< std::pair< double, double > > _buffer;
+
+            void accumulate(const double& value, const double& weight);
+    };
+
+    class STATISKIT_CORE_API StreamingQuantileEstimation : public QuantileEstimation
+    {
+        public:
+            StreamingQuantileEstimation(const UnivariateQuantileStatistic& statistic);
+            StreamingQuantileEstimation(const StreamingQuantileEstimation& estimation);
+
+            virtual double get_quantile(const double& p) const;
+
+            const UnivariateQuantileStatistic& get_statistic() const;
+
+            class STATISKIT_CORE_API Estimator : public QuantileEstimation::Estimator
+            {
+                public:
+                    Estimator();
+                    Estimator(const double& compression);
+                    Estimator(const Estimator& estimator);
+
+                    virtual std::unique_ptr< QuantileEstimation > operator() (const UnivariateData& data) const;
+
+                    virtual std::unique_ptr< QuantileEstimation::Estimator > copy() const;
+
+                    const double& get_compression() const;
+                    void set_compression(const double& compression);
+
+                protected:
+                    double _compression;
+            };
+
+        protected:
+            UnivariateQuantileStatistic _statistic;
     };
 
     /*class CoVarianceEstimation
@@ -247,57 +770,6 @@ namespace statiskit
             double _covariance;
             bool _bias;
     };*/
-
-    /*struct CoSkewnessEstimator
-    {
-        virtual double operator() (const UnivariateData& df) const;
-        virtual double operator() (const Index& i, const Index& j, const Index& k, const MultivariateDataFrame& df, const bool& na_omit=true) const = 0;
-    };
-
-    struct CoKurtosisEstimator
-    {
-        virtual double operator() (const UnivariateData& df, const bool& na_omit=true) const;
-        virtual double operator() (const Index& i, const Index& j, const Index& k, const Index& l, const MultivariateDataFrame& df, const bool& na_omit=true) const = 0;
-    };*/
-
-    /*struct MomentEstimator
-    {
-        virtual double operator() (const UnivariateData* df, const bool& na_omit=true) const = 0;
-        virtual double operator() (const std::array< const UnivariateData*, 2 >& df, const bool& na_omit=true) const;
-        virtual double operator() (const std::array< const UnivariateData*, 2 >& df, const std::array<double, 2>& mean, const bool& na_omit=true) const = 0;
-        virtual double operator() (const std::array< const UnivariateData*, 3 >& df, const bool& na_omit=true) const;
-        virtual double operator() (const std::array< const UnivariateData*, 3 >& df, const std::array<double, 3>& mean, const bool& na_omit=true) const;
-        virtual double operator() (const std::array< const UnivariateData*, 3 >& df, const std::array<double, 3>& mean, const std::array<double, 3>& stderror, const bool& na_omit=true) const = 0;
-        virtual double operator() (const std::array< const UnivariateData*, 4 >& df, const bool& na_omit=true) const;
-        virtual double operator() (const std::array< const UnivariateData*, 4 >& df, const std::array<double, 4>& mean, const bool& na_omit=true) const;
-        virtual double operator() (const std::array< const UnivariateData*, 4 >& df, const std::array<double, 4>& mean, const std::array<double, 4>& stderror, const bool& na_omit=true) const = 0;
-
-        virtual std::unique_ptr< MomentEstimator > copy() const = 0;
-    };
-
-    class NaturalMomentEstimator : public MomentEstimator
-    {
-        public:
-            NaturalMomentEstimator(const bool& biased=false);
-            NaturalMomentEstimator(const NaturalMomentEstimator& estimator);
-            virtual ~NaturalMomentEstimator();
-
-            virtual double operator() (const UnivariateData* df, const bool& na_omit=true) const;
-            virtual double operator() (const std::array< const UnivariateData*, 2 >& df, const std::array<double, 2>& mean, const bool& na_omit=true) const;
-            virtual double operator() (const std::array< const UnivariateData*, 3 >& df, const std::array<double, 3>& mean, const std::array<double, 3>& stderror, const bool& na_omit=true) const;
-            virtual double operator() (const std::array< const UnivariateData*, 4 >& df, const std::array<double, 4>& mean, const std::array<double, 4>& stderror, const bool& na_omit=true) const;
-
-            const bool& get_biased() const;
-
-            virtual std::unique_ptr< MomentEstimator > copy() const;
-
-        protected:
-            bool _biased;
-
-            template<class E> double get_value(const UnivariateData* data, const Index& index, const bool& na_omit=true) const;
-            template<class E> double get_value(const UnivariateData* data, const Index& index, const double& mean, const bool& na_omit=true) const;
-            template<class E> double get_value(const UnivariateEvent* event, const double& completion, const bool& na_omit=true) const;
-    };*/
 }
 
 #endif
@@ -22,6 +22,22 @@ namespace statiskit
     void SlopeHeuristicSolver::set_solver(const linalg::solver_type& solver)
     { _solver = solver;; }
 
+    Eigen::MatrixXd SlopeHeuristicSolver::path(const Eigen::VectorXd& x, const Eigen::VectorXd& y) const
+    {
+        Eigen::MatrixXd betas = Eigen::MatrixXd::Constant(2, x.size(), std::numeric_limits< double >::quiet_NaN());
+        Eigen::MatrixXd X(x.size(), 2);
+        X.col(0).setOnes();
+        X.col(1) = x;
+        for(Index index = 2, max_index = x.size(); index <= max_index; ++index)
+        {
+            try
+            { betas.col(index - 1) = (*this)(X.topRows(index), y.head(index)); }
+            catch(const std::exception& error)
+            {}
+        }
+        return betas;
+    }
+
     SlopeHeuristicOLSSolver::SlopeHeuristicOLSSolver() : SlopeHeuristicSolver()
     {}
 
@@ -31,6 +47,31 @@ namespace statiskit
     Eigen::VectorXd SlopeHeuristicOLSSolver::operator() (const Eigen::MatrixXd& X, const Eigen::VectorXd& y) const
     { return linalg::solve(X.transpose() * X, (X.transpose() * y).eval(), _solver); }
 
+    Eigen::MatrixXd SlopeHeuristicOLSSolver::path(const Eigen::VectorXd& x, const Eigen::VectorXd& y) const
+    {
+        Eigen::MatrixXd betas = Eigen::MatrixXd::Constant(2, x.size(), std::numeric_limits< double >::quiet_NaN());
+        Eigen::MatrixXd A = Eigen::MatrixXd::Zero(2, 2);
+        Eigen::VectorXd b = Eigen::VectorXd::Zero(2);
+        for(Index index = 0, max_index = x.size(); index < max_index; ++index)
+        {
+            // Rank-one update of the normal equations
+            A(0, 0) += 1.;
+            A(0, 1) += x(index);
+            A(1, 1) += x(index) * x(index);
+            A(1, 0) = A(0, 1);
+            b(0) += y(index);
+            b(1) += x(index) * y(index);
+            if(index > 0)
+            {
+                try
+                { betas.col(index) = linalg::solve(A, b, _solver); }
+                catch(const std::exception& error)
+                {}
+            }
+        }
+        return betas;
+    }
+
     std::unique_ptr< SlopeHeuristicSolver > SlopeHeuristicOLSSolver::copy() const
     { return std::make_unique< SlopeHeuristicOLSSolver >(); }
 
@@ -47,20 +88,61 @@ namespace statiskit
     }
 
     Eigen::VectorXd SlopeHeuristicIWLSSolver::operator() (const Eigen::MatrixXd& X, const Eigen::VectorXd& y) const
+    { return iterate(X, y, linalg::solve(X.transpose() * X, (X.transpose() * y).eval(), _solver)); }
+
+    Eigen::MatrixXd SlopeHeuristicIWLSSolver::path(const Eigen::VectorXd& x, const Eigen::VectorXd& y) const
+    {
+        Eigen::MatrixXd betas = Eigen::MatrixXd::Constant(2, x.size(), std::numeric_limits< double >::quiet_NaN());
+        Eigen::MatrixXd X(x.size(), 2);
+        X.col(0).setOnes();
+        X.col(1) = x;
+        Eigen::MatrixXd A = Eigen::MatrixXd::Zero(2, 2);
+        Eigen::VectorXd b = Eigen::VectorXd::Zero(2);
+        for(Index index = 0, max_index = x.size(); index < max_index; ++index)
+        {
+            // Ordinary least squares are obtained by rank-one updates and only used for redescending losses or when the previous prefix failed
+            A(0, 0) += 1.;
+            A(0, 1) += x(index);
+            A(1, 1) += x(index) * x(index);
+            A(1, 0) = A(0, 1);
+            b(0) += y(index);
+            b(1) += x(index) * y(index);
+            if(index > 0)
+            {
+                try
+                {
+                    if(index > 1 && !is_redescending() && betas.col(index - 1).allFinite())
+                    { betas.col(index) = iterate(X.topRows(index + 1), y.head(index + 1), betas.col(index - 1)); }
+                    else
+                    { betas.col(index) = iterate(X.topRows(index + 1), y.head(index + 1), linalg::solve(A, b, _solver)); }
+                }
+                catch(const std::exception& error)
+                {}
+            }
+        }
+        return betas;
+    }
+
+    Eigen::VectorXd SlopeHeuristicIWLSSolver::iterate(const Eigen::Ref< const Eigen::MatrixXd >& X, const Eigen::Ref< const Eigen::VectorXd >& y, const Eigen::VectorXd& beta) const
     {
-        Eigen::MatrixXd W = (Eigen::VectorXd::Ones(y.rows())).asDiagonal();
-        Eigen::VectorXd bp, bc = linalg::solve(X.transpose() * X, (X.transpose() * y).eval(), _solver);
+        Eigen::VectorXd weights = Eigen::VectorXd::Ones(y.rows());
+        Eigen::VectorXd bp, bc = beta;
         unsigned int its = 0;
         do
         {
             bp = bc;
-            update(bp, W, X, y);
-            bc = linalg::solve(X.transpose() * W * X, (X.transpose() * W * y).eval(), _solver);
+            update(y - X * bp, weights);
+            Eigen::MatrixXd A = X.transpose() * weights.asDiagonal() * X;
+            Eigen::VectorXd b = X.transpose() * weights.cwiseProduct(y);
+            bc = linalg::solve(A, b, _solver);
             ++its;
         } while((bc - bp).array().square().sqrt().sum() > _epsilon * bp.array().abs().sum() && its < _maxits);
         return bc;
     }
     
+    bool SlopeHeuristicIWLSSolver::is_redescending() const
+    { return true; }
+
     const double& SlopeHeuristicIWLSSolver::get_epsilon() const
     { return _epsilon; }
 
@@ -88,20 +170,21 @@ namespace statiskit
     void SlopeHeuristicHuberSolver::set_k(const double& k)
     { _k = k; }
 
-    void SlopeHeuristicHuberSolver::update(const Eigen::VectorXd& beta, Eigen::MatrixXd& W, const Eigen::MatrixXd& X, const Eigen::VectorXd& y) const
+    void SlopeHeuristicHuberSolver::update(const Eigen::VectorXd& errors, Eigen::VectorXd& weights) const
     {
-        Eigen::VectorXd errors = y - X * beta;
-        double sigma = _k * errors.norm() / sqrt(y.size());
-        errors = errors.cwiseAbs();
-        for(Index index = 0, max_index = y.size(); index < max_index; ++index)
+        double sigma = _k * errors.norm() / sqrt(errors.size());
+        for(Index index = 0, max_index = errors.size(); index < max_index; ++index)
         {
-            if(errors(index) <= sigma)
-            { W(index, index) = 1; }
+            if(fabs(errors(index)) <= sigma)
+            { weights(index) = 1; }
             else
-            { W(index, index) = sigma / errors(index); }
+            { weights(index) = sigma / fabs(errors(index)); }
         }
     }
 
+    bool SlopeHeuristicHuberSolver::is_redescending() const
+    { return false; }
+
     SlopeHeuristicBiSquareSolver::SlopeHeuristicBiSquareSolver() : SlopeHeuristicIWLSSolver()
     { _k = 4.685; }
 
@@ -117,17 +200,15 @@ namespace statiskit
     void SlopeHeuristicBiSquareSolver::set_k(const double& k)
     { _k = k; }
 
-    void SlopeHeuristicBiSquareSolver::update(const Eigen::VectorXd& beta, Eigen::MatrixXd& W, const Eigen::MatrixXd& X, const Eigen::VectorXd& y) const
+    void SlopeHeuristicBiSquareSolver::update(const Eigen::VectorXd& errors, Eigen::VectorXd& weights) const
     {
-        Eigen::VectorXd errors = y - X * beta;
-        double sigma = _k * errors.norm() / sqrt(y.size());
-        errors = errors.cwiseAbs();
-        for(Index index = 0, max_index = y.size(); index < max_index; ++index)
+        double sigma = _k * errors.norm() / sqrt(errors.size());
+        for(Index index = 0, max_index = errors.size(); index < max_index; ++index)
         {
-            if(errors(index) <= sigma)
-            { W(index, index) = pow(1 - pow(errors(index) / sigma, 2), 2); }
+            if(fabs(errors(index)) <= sigma)
+            { weights(index) = pow(1 - pow(errors(index) / sigma, 2), 2); }
             else
-            { W(index, index) = 0.; }
+            { weights(index) = 0.; }
         }
     }
 
@@ -320,24 +401,18 @@ namespace statiskit
     {
         _intercepts = std::vector< double >(size(), std::numeric_limits< double >::quiet_NaN());
         _slopes = std::vector< double >(size(), std::numeric_limits< double >::quiet_NaN());
+        // Regressions are only needed for prefixes with at least two and at most size() - 1 points
+        Eigen::VectorXd x(std::max< Index >(size(), 1) - 1), y(std::max< Index >(size(), 1) - 1);
+        for(Index shift = 0, max_shift = x.size(); shift < max_shift; ++shift)
+        {
+            x(shift) = _penshapes[size() - shift - 1];
+            y(shift) = _scores[size() - shift - 1];
+        }
+        Eigen::MatrixXd betas = _solver->path(x, y);
         for(Index index = 2, max_index = size(); index < max_index; ++index)
         {
-            Eigen::MatrixXd X(index, 2);
-            Eigen::VectorXd y(index);
-            for(Index shift = 0; shift < index; ++shift)
-            {
-                X(shift, 0) = 1;
-                X(shift, 1) = _penshapes[max_index - shift - 1];
-                y(shift) = _scores[max_index - shift - 1];
-            }
-            try
-            {
-                Eigen::VectorXd beta = (*_solver)(X, y);
-                _intercepts[index - 1] = beta(0);
-                _slopes[index - 1] = beta(1);
-            }
-            catch(const std::exception& error)
-            {}
+            _intercepts[index - 1] = betas(0, index - 1);
+            _slopes[index - 1] = betas(1, index - 1);
         }
         _selected = std::vector< Index >(_slopes.size());
         for(Index index = 1, max_index = size(); index < max_index; ++index)
@@ -10,6 +10,7 @@
 #define STATISKIT_CORE_SLOPE_HEURISTIC_H
 
 #include "base.h"
+#include "estimation.h"
 
 #include <statiskit/linalg/Eigen.h>
 
@@ -26,6 +27,7 @@ namespace statiskit
             SlopeHeuristicSolver(const SlopeHeuristicSolver& solver);
 
             virtual Eigen::VectorXd operator() (const Eigen::MatrixXd& X, const Eigen::VectorXd& y) const = 0;
+            virtual Eigen::MatrixXd path(const Eigen::VectorXd& x, const Eigen::VectorXd& y) const;
 
             linalg::solver_type get_solver() const;
             void set_solver(const linalg::solver_type& solver);
@@ -42,6 +44,7 @@ namespace statiskit
         SlopeHeuristicOLSSolver(const SlopeHeuristicOLSSolver& solver);
 
         virtual Eigen::VectorXd operator() (const Eigen::MatrixXd& X, const Eigen::VectorXd& y) const; 
+        virtual Eigen::MatrixXd path(const Eigen::VectorXd& x, const Eigen::VectorXd& y) const;
 
         virtual std::unique_ptr< SlopeHeuristicSolver > copy() const;
     };
@@ -53,6 +56,7 @@ namespace statiskit
             SlopeHeuristicIWLSSolver(const SlopeHeuristicIWLSSolver& shs);
 
             virtual Eigen::VectorXd operator() (const Eigen::MatrixXd& X, const Eigen::VectorXd& y) const;
+            virtual Eigen::MatrixXd path(const Eigen::VectorXd& x, const Eigen::VectorXd& y) const;
 
             const double& get_epsilon() const;
             void set_epsilon(const double& epsilon);
@@ -64,7 +68,12 @@ namespace statiskit
             double _epsilon;
             unsigned int _maxits;
 
-            virtual void update(const Eigen::VectorXd& beta, Eigen::MatrixXd& W, const Eigen::MatrixXd& X, const Eigen::VectorXd& y) const = 0;
+            Eigen::VectorXd iterate(const Eigen::Ref< const Eigen::MatrixXd >& X, const Eigen::Ref< const Eigen::VectorXd >& y, const Eigen::VectorXd& beta) const;
+
+            virtual void update(const Eigen::VectorXd& errors, Eigen::VectorXd& weights) const = 0;
+
+            /** Warm-started fits of redescending losses can reach another local optimum, \ref ::statiskit::SlopeHeuristicIWLSSolver::path therefore cold-starts each prefix for them */
+            virtual bool is_redescending() const;
     };
 
     class STATISKIT_CORE_API SlopeHeuristicHuberSolver : public SlopeHeuristicIWLSSolver
@@ -81,7 +90,9 @@ namespace statiskit
         protected:
             double _k;
 
-            virtual void update(const Eigen::VectorXd& beta, Eigen::MatrixXd& W, const Eigen::MatrixXd& X, const Eigen::VectorXd& y) const;
+            virtual void update(const Eigen::VectorXd& errors, Eigen::VectorXd& weights) const;
+
+            virtual bool is_redescending() const;
     };
 
     class STATISKIT_CORE_API SlopeHeuristicBiSquareSolver : public SlopeHeuristicIWLSSolver
@@ -98,7 +109,7 @@ namespace statiskit
          protected:
             double _k;
 
-            virtual void update(const Eigen::VectorXd& beta, Eigen::MatrixXd& W, const Eigen::MatrixXd& X, const Eigen::VectorXd& y) const;
+            virtual void update(const Eigen::VectorXd& errors, Eigen::VectorXd& weights) const;
     };
 
     class SlopeHeuristic;
@@ -187,14 +198,42 @@ namespace statiskit
 
             virtual typename E::estimated_type const * get_estimated() const;
 
-            const typename E::estimated_type* get_proposal(const Index& index) const;
+            virtual const typename E::estimated_type* get_proposal(const Index& index) const;
 
             const typename E::data_type* get_data() const;
 
+            class Estimator : public PolymorphicCopy< typename E::Estimator::estimation_type::Estimator, Estimator, typename E::Estimator >
+            {
+                public:
+                    Estimator();
+                    Estimator(const Estimator& estimator);
+                    virtual ~Estimator();
+
+                    virtual std::unique_ptr< typename E::Estimator::estimation_type > operator() (const typename E::data_type& data, const bool& lazy=true) const;
+
+                    Index size() const;
+
+                    const double& get_penshape(const Index& index) const;
+
+                    typename E::Estimator* get_estimator(const Index& index);
+
+                    void add_estimator(const double& penshape, const typename E::Estimator& estimator);
+                    void remove_estimator(const Index& index);
+
+                    const bool& get_lazy_proposals() const;
+                    void set_lazy_proposals(const bool& lazy_proposals);
+
+                protected:
+                    std::vector< double > _penshapes;
+                    std::vector< typename E::Estimator* > _estimators;
+                    bool _lazy_proposals;
+            };
             
         protected:
             typename E::data_type* _data;
             std::vector< typename E::estimated_type* > _proposals;
+            std::vector< typename E::Estimator* > _estimators;
+            mutable std::mutex _mutex;
 
             void add(const double& penshape, const double& score, typename E::estimated_type* model);
     };
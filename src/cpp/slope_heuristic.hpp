@@ -15,6 +15,7 @@ namespace statiskit
         SlopeHeuristicSelection< E >::SlopeHeuristicSelection(const typename E::data_type* data) : SlopeHeuristic()
         { 
             _proposals.clear();
+            _estimators.clear();
             if(data)
             { _data = data->copy().release(); }
             else
@@ -26,7 +27,16 @@ namespace statiskit
         {
             _proposals = std::vector< typename E::estimated_type* >(she._proposals.size(), nullptr);
             for(Index index = 0, max_index = _proposals.size(); index < max_index; ++index)
-            { _proposals[index] = static_cast< typename E::estimated_type* >(she._proposals[index]->copy().release()); }
+            {
+                if(she._proposals[index])
+                { _proposals[index] = static_cast< typename E::estimated_type* >(she._proposals[index]->copy().release()); }
+            }
+            _estimators = std::vector< typename E::Estimator* >(she._estimators.size(), nullptr);
+            for(Index index = 0, max_index = _estimators.size(); index < max_index; ++index)
+            {
+                if(she._estimators[index])
+                { _estimators[index] = static_cast< typename E::Estimator* >(she._estimators[index]->copy().release()); }
+            }
             if(she._data)
             { _data = static_cast< typename E::data_type* >(she._data->copy().release()); }
             else
@@ -42,6 +52,12 @@ namespace statiskit
                 _proposals[index] = nullptr;
             }
             _proposals.clear();
+            for(Index index = 0, max_index = _estimators.size(); index < max_index; ++index)
+            {
+                delete _estimators[index];
+                _estimators[index] = nullptr;
+            }
+            _estimators.clear();
             if(_data)
             {
                 delete _data;
@@ -52,15 +68,25 @@ namespace statiskit
     template<class E>
         typename E::estimated_type const * SlopeHeuristicSelection< E >::get_estimated() const
         { 
-            typename E::estimated_type const * estimated;
+            typename E::estimated_type const * estimated = nullptr;
             if(this->_selected.size() > 0)
-            { estimated = _proposals[this->_selected[(*this->_selector)(*this)]]; }
+            { estimated = get_proposal(this->_selected[(*this->_selector)(*this)]); }
             return estimated;
         }
 
     template<class E>
         const typename E::estimated_type* SlopeHeuristicSelection< E >::get_proposal(const Index& index) const
-        { return _proposals[index]; }
+        {
+            if(index >= size())
+            { throw size_error("index", size(), size_error::inferior); }
+            std::lock_guard< std::mutex > lock(_mutex);
+            if(!_proposals[index] && index < _estimators.size() && _estimators[index] && _data)
+            {
+                std::unique_ptr< typename E::Estimator::estimation_type > estimation = (*(_estimators[index]))(*_data, true);
+                const_cast< SlopeHeuristicSelection< E >* >(this)->_proposals[index] = static_cast< typename E::estimated_type* >(estimation->get_estimated()->copy().release());
+            }
+            return _proposals[index];
+        }
 
     template<class E>
         const typename E::data_type* SlopeHeuristicSelection< E >::get_data() const
@@ -87,6 +113,8 @@ namespace statiskit
                         this->_scores[index] = score;
                         _proposals[index] = estimated;
                     }
+                    else
+                    { delete estimated; }
                 }
                 else
                 {
@@ -96,7 +124,154 @@ namespace statiskit
                     _proposals.insert(_proposals.begin() + index, estimated);
                 }
             }
+            else
+            { delete estimated; }
         }
+
+    template<class E>
+        SlopeHeuristicSelection< E >::Estimator::Estimator()
+        {
+            _penshapes.clear();
+            _estimators.clear();
+            _lazy_proposals = false;
+        }
+
+    template<class E>
+        SlopeHeuristicSelection< E >::Estimator::Estimator(const Estimator& estimator)
+        {
+            _penshapes = estimator._penshapes;
+            _estimators.resize(estimator.size());
+            for(Index index = 0, max_index = estimator.size(); index < max_index; ++index)
+            { _estimators[index] = static_cast< typename E::Estimator* >(estimator._estimators[index]->copy().release()); }
+            _lazy_proposals = estimator._lazy_proposals;
+        }
+
+    template<class E>
+        SlopeHeuristicSelection< E >::Estimator::~Estimator()
+        {
+            for(Index index = 0, max_index = _estimators.size(); index < max_index; ++index)
+            { 
+                delete _estimators[index];
+                _estimators[index] = nullptr;
+            }
+            _estimators.clear();
+        }
+
+    template<class E>
+        std::unique_ptr< typename E::Estimator::estimation_type > SlopeHeuristicSelection< E >::Estimator::operator() (const typename E::data_type& data, const bool& lazy) const
+        {
+            // Candidates are fitted and scored concurrently but added to the selection in their order
+            std::vector< std::unique_ptr< typename E::Estimator::estimation_type > > estimations(size());
+            std::vector< double > scores(size(), std::numeric_limits< double >::quiet_NaN());
+            __impl::parallel_for(size(), [this, &data, &estimations, &scores](const Index& index)
+            {
+                try
+                {
+                    estimations[index] = (*(_estimators[index]))(data, true);
+                    if(estimations[index] && estimations[index]->get_estimated())
+                    { scores[index] = estimations[index]->get_estimated()->loglikelihood(data); }
+                }
+                catch(const std::exception& error)
+                { estimations[index].reset(); }
+            });
+            SlopeHeuristicSelection< E >* selection;
+            if(lazy)
+            { selection = new SlopeHeuristicSelection< E >(nullptr); }
+            else
+            { selection = new SlopeHeuristicSelection< E >(&data); }
+            std::map< double, std::pair< double, Index > > candidates;
+            for(Index index = 0, max_index = size(); index < max_index; ++index)
+            {
+                if(estimations[index] && estimations[index]->get_estimated())
+                {
+                    if(boost::math::isfinite(_penshapes[index]) && boost::math::isfinite(scores[index]))
+                    {
+                        std::map< double, std::pair< double, Index > >::iterator it = candidates.find(_penshapes[index]);
+                        if(it == candidates.end())
+                        { candidates[_penshapes[index]] = std::make_pair(scores[index], index); }
+                        else if(it->second.first < scores[index])
+                        { it->second = std::make_pair(scores[index], index); }
+                    }
+                    selection->add(_penshapes[index], scores[index], static_cast< typename E::estimated_type* >(estimations[index]->get_estimated()->copy().release()));
+                }
+                estimations[index].reset();
+            }
+            selection->finalize();
+            std::unique_ptr< typename E::Estimator::estimation_type > estimation;
+            if(lazy)
+            {
+                if(selection->get_estimated())
+                { estimation = std::make_unique< LazyEstimation< typename E::estimated_type, E > >(static_cast< typename E::estimated_type* >(selection->get_estimated()->copy().release())); }
+                delete selection;
+            }
+            else
+            {
+                if(_lazy_proposals && selection->_selected.size() > 0)
+                {
+                    // Only the selected proposal is kept, others are fitted again on demand
+                    Index selected = selection->_selected[(*selection->_selector)(*selection)];
+                    selection->_estimators.resize(selection->size(), nullptr);
+                    for(Index index = 0, max_index = selection->size(); index < max_index; ++index)
+                    {
+                        selection->_estimators[index] = static_cast< typename E::Estimator* >(_estimators[candidates[selection->get_penshape(index)].second]->copy().release());
+                        if(index != selected)
+                        {
+                            delete selection->_proposals[index];
+                            selection->_proposals[index] = nullptr;
+                        }
+                    }
+                }
+                estimation.reset(selection);
+            }
+            if(!estimation || !estimation->get_estimated())
+            { throw std::runtime_error("All estimations failed, perform manually the estimation in order to investigate what went wrong"); }
+            return estimation;
+        }
+
+    template<class E>
+        Index SlopeHeuristicSelection< E >::Estimator::size() const
+        { return _estimators.size(); }
+
+    template<class E>
+        const double& SlopeHeuristicSelection< E >::Estimator::get_penshape(const Index& index) const
+        {
+            if(index >= size())
+            { throw size_error("index", size(), size_error::inferior); }
+            return _penshapes[index];
+        }
+
+    template<class E>
+        typename E::Estimator* SlopeHeuristicSelection< E >::Estimator::get_estimator(const Index& index)
+        {
+            if(index >= size())
+            { throw size_error("index", size(), size_error::inferior); }
+            return _estimators[index];
+        }
+
+    template<class E>
+        void SlopeHeuristicSelection< E >::Estimator::add_estimator(const double& penshape, const typename E::Estimator& estimator)
+        {
+            _penshapes.push_back(penshape);
+            _estimators.push_back(static_cast< typename E::Estimator* >(estimator.copy().release()));
+        }
+
+    template<class E>
+        void SlopeHeuristicSelection< E >::Estimator::remove_estimator(const Index& index)
+        {
+            if(index >= size())
+            { throw size_error("index", size(), size_error::inferior); }
+            delete _estimators[index];
+            _estimators.erase(_estimators.begin() + index);
+            _penshapes.erase(_penshapes.begin() + index);
+        }
+
+    template<class E>
+        const bool& SlopeHeuristicSelection< E >::Estimator::get_lazy_proposals() const
+        { return _lazy_proposals; }
+
+    template<class E>
+        void SlopeHeuristicSelection< E >::Estimator::set_lazy_proposals(const bool& lazy_proposals)
+        { _lazy_proposals = lazy_proposals; }
 }
 
 #endif
@@ -1,9 +1,10 @@
 from functools import wraps
 
 import statiskit.core._core
-from statiskit.core.__core.statiskit import (Optimization,)
+from statiskit.core.__core.statiskit import (Optimization,
+                                             get_nb_threads, set_nb_threads)
 
-__all__ = []
+__all__ = ['get_nb_threads', 'set_nb_threads']
 
 Optimization.mindiff = property(Optimization.get_mindiff, Optimization.set_mindiff)
 del Optimization.get_mindiff, Optimization.set_mindiff
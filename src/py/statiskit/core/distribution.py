@@ -30,6 +30,12 @@ from __core.statiskit import (UnivariateDistribution,
                                     UnivariateHistogramDistribution,
                                     NormalDistribution,
                                     LogisticDistribution,
+                                    LaplaceDistribution,
+                                    CauchyDistribution,
+                                    NonStandardStudentDistribution,
+                                    GeneralizedStudentDistribution,
+                                    GumbelMaxDistribution,
+                                    GumbelMinDistribution,
                                     ContinuousUnivariateMixtureDistribution,
                               MultivariateDistribution,
                                 _IndependentMultivariateDistribution,
@@ -80,6 +86,12 @@ __all__ = ['NominalDistribution',
            'UnivariateHistogramDistribution',
            'NormalDistribution',
            'LogisticDistribution',
+           'LaplaceDistribution',
+           'CauchyDistribution',
+           'NonStandardStudentDistribution',
+           'GeneralizedStudentDistribution',
+           'GumbelMaxDistribution',
+           'GumbelMinDistribution',
            'MultinomialSplittingDistribution',
            'MultinormalDistribution',
            'IndependentMultivariateDistribution',
@@ -745,16 +757,33 @@ def statiskit_univariate_mixture_distribution_decorator(cls):
 
     def wrapper_posterior(f):
         @wraps(f)
-        def posterior(self, event, **kwargs):
-            return f(self, type_to_event(event), kwargs.pop('log', False))
+        def posterior(self, arg, **kwargs):
+            if isinstance(arg, UnivariateData):
+                return f(self, arg, kwargs.pop('log', False))
+            else:
+                return f(self, type_to_event(arg), kwargs.pop('log', False))
         return posterior
 
     cls.posterior = wrapper_posterior(cls.posterior)
 
+    def wrapper_log_posterior(f):
+        @wraps(f)
+        def log_posterior(self, arg):
+            if isinstance(arg, UnivariateData):
+                return f(self, arg)
+            else:
+                return f(self, type_to_event(arg))
+        return log_posterior
+
+    cls.log_posterior = wrapper_log_posterior(cls.log_posterior)
+
     def wrapper_assignement(f):
         @wraps(f)
-        def assignement(self, event):
-            return f(self, type_to_event(event))
+        def assignement(self, arg):
+            if isinstance(arg, UnivariateData):
+                return f(self, arg)
+            else:
+                return f(self, type_to_event(arg))
         return assignement
 
     cls.assignement = wrapper_assignement(cls.assignement)
@@ -765,7 +794,7 @@ def statiskit_univariate_mixture_distribution_decorator(cls):
             if isinstance(arg, UnivariateData):
                 return f(self, arg)
             else:
-                return f(self, types_to_event(arg))
+                return f(self, type_to_event(arg))
         return uncertainty
 
     cls.uncertainty = wrapper_uncertainty(cls.uncertainty)
@@ -777,16 +806,33 @@ def statiskit_multivariate_mixture_distribution_decorator(cls):
 
     def wrapper_posterior(f):
         @wraps(f)
-        def posterior(self, *event, **kwargs):
-            return f(self, types_to_event(*events), kwargs.pop('log', False))
+        def posterior(self, *args, **kwargs):
+            if len(args) == 1 and isinstance(args[0], MultivariateData):
+                return f(self, args[0], kwargs.pop('log', False))
+            else:
+                return f(self, types_to_event(*args), kwargs.pop('log', False))
         return posterior
 
     cls.posterior = wrapper_posterior(cls.posterior)
 
+    def wrapper_log_posterior(f):
+        @wraps(f)
+        def log_posterior(self, *args):
+            if len(args) == 1 and isinstance(args[0], MultivariateData):
+                return f(self, args[0])
+            else:
+                return f(self, types_to_event(*args))
+        return log_posterior
+
+    cls.log_posterior = wrapper_log_posterior(cls.log_posterior)
+
     def wrapper_assignement(f):
         @wraps(f)
-        def assignement(self, *event):
-            return f(self, types_to_event(*event))
+        def assignement(self, *args):
+            if len(args) == 1 and isinstance(args[0], MultivariateData):
+                return f(self, args[0])
+            else:
+                return f(self, types_to_event(*args))
         return assignement
 
     cls.assignement = wrapper_assignement(cls.assignement)
@@ -12,43 +12,73 @@ from optionals import pyplot
 
 import statiskit.core._core
 from statiskit.core.__core.statiskit import (_LazyEstimation, _ActiveEstimation, _OptimizationEstimationImpl, _Selection, _OptimizationEstimation,
+                                             UnivariateDataStatistic, MultivariateDataStatistic,
                                              UnivariateDistributionEstimation,
                                                 CategoricalUnivariateDistributionEstimation,
                                                     CategoricalUnivariateDistributionSelection,
+                                                    CategoricalUnivariateDistributionCachedEstimator,
                                                     CategoricalUnivariateMixtureDistributionEMEstimation,
+                                                    CategoricalUnivariateMixtureDistributionCEMEstimation,
+                                                    CategoricalUnivariateMixtureDistributionEMSelection,
                                                 DiscreteUnivariateDistributionEstimation, 
                                                     DiscreteUnivariateFrequencyDistributionEstimation,
                                                     DiscreteUnivariateDistributionSelection,
+                                                    DiscreteUnivariateDistributionCachedEstimator,
+                                                    DiscreteUnivariateDistributionSlopeHeuristicSelection,
                                                     PoissonDistributionMLEstimation,# PoissonDistributionMMEstimation,
                                                     BinomialDistributionMLEstimation, BinomialDistributionMMEstimation,
                                                     NegativeBinomialDistributionMLEstimation, NegativeBinomialDistributionMMEstimation,
                                                     DiscreteUnivariateMixtureDistributionEMEstimation,
+                                                    DiscreteUnivariateMixtureDistributionCEMEstimation,
+                                                    DiscreteUnivariateMixtureDistributionEMSelection,
                                                 ContinuousUnivariateDistributionEstimation,
                                                     ContinuousUnivariateDistributionSelection,
+                                                    ContinuousUnivariateDistributionCachedEstimator,
+                                                    ContinuousUnivariateDistributionSlopeHeuristicSelection,
                                                     ContinuousUnivariateFrequencyDistributionEstimation,
                                                     NormalDistributionMLEstimation,
+                                                    LaplaceDistributionMLEstimation,
+                                                    LogisticDistributionMLEstimation,
+                                                    CauchyDistributionMLEstimation,
+                                                    GumbelMaxDistributionMLEstimation,
+                                                    GumbelMinDistributionMLEstimation,
+                                                    NonStandardStudentDistributionMLEstimation,
                                                     UnivariateHistogramDistributionEstimation,
                                                     RegularUnivariateHistogramDistributionSlopeHeuristicSelection,
                                                     IrregularUnivariateHistogramDistributionSlopeHeuristicSelection,
                                                     ContinuousUnivariateMixtureDistributionEMEstimation,
+                                                    ContinuousUnivariateMixtureDistributionCEMEstimation,
+                                                    ContinuousUnivariateMixtureDistributionEMSelection,
                                              MultivariateDistributionEstimation,
                                                  MixedMultivariateDistributionSelection,
+                                                 MixedMultivariateDistributionCachedEstimator,
                                                 _IndependentMultivariateDistributionEstimation,
                                                 MixedIndependentMultivariateDistributionEstimation,
                                                 MixedMultivariateMixtureDistributionEMEstimation,
+                                                MixedMultivariateMixtureDistributionCEMEstimation,
+                                                MixedMultivariateMixtureDistributionEMSelection,
                                                 CategoricalMultivariateDistributionEstimation,
                                                     CategoricalMultivariateDistributionSelection,
+                                                    CategoricalMultivariateDistributionCachedEstimator,
                                                     CategoricalIndependentMultivariateDistributionEstimation,
                                                     CategoricalMultivariateMixtureDistributionEMEstimation,
+                                                    CategoricalMultivariateMixtureDistributionCEMEstimation,
+                                                    CategoricalMultivariateMixtureDistributionEMSelection,
                                                 DiscreteMultivariateDistributionEstimation,
                                                     DiscreteMultivariateDistributionSelection,
+                                                    DiscreteMultivariateDistributionCachedEstimator,
                                                     MultinomialSplittingDistributionEstimation,
                                                     DiscreteIndependentMultivariateDistributionEstimation,
                                                     DiscreteMultivariateMixtureDistributionEMEstimation,
+                                                    DiscreteMultivariateMixtureDistributionCEMEstimation,
+                                                    DiscreteMultivariateMixtureDistributionEMSelection,
                                                 ContinuousMultivariateDistributionEstimation,
                                                     ContinuousMultivariateDistributionSelection,
+                                                    ContinuousMultivariateDistributionCachedEstimator,
                                                     ContinuousIndependentMultivariateDistributionEstimation,
                                                     ContinuousMultivariateMixtureDistributionEMEstimation,
+                                                    ContinuousMultivariateMixtureDistributionCEMEstimation,
+                                                    ContinuousMultivariateMixtureDistributionEMSelection,
                                              _MixtureDistributionEMEstimation)
 
 from event import outcome_type
@@ -60,11 +90,18 @@ __all__ = ['frequency_estimation',
            'poisson_estimation',
            'negative_binomial_estimation',
            'normal_estimation',
+           'laplace_estimation',
+           'logistic_estimation',
+           'cauchy_estimation',
+           'gumbel_max_estimation',
+           'gumbel_min_estimation',
+           'student_estimation',
            'histogram_estimation',
            'multinomial_splitting_estimation',
            'independent_estimation',
            'mixture_estimation',
-           'selection']
+           'selection',
+           'cached_estimation']
 
 UnivariateDistributionEstimation.estimated = property(UnivariateDistributionEstimation.get_estimated)
 del UnivariateDistributionEstimation.get_estimated
@@ -223,6 +260,12 @@ def selection_decorator(cls):
 
     estimator_decorator(cls.Estimator)
 
+    cls.CrossValidationEstimator.nb_folds = property(cls.CrossValidationEstimator.get_nb_folds, cls.CrossValidationEstimator.set_nb_folds)
+    del cls.CrossValidationEstimator.get_nb_folds, cls.CrossValidationEstimator.set_nb_folds
+
+    cls.CrossValidationEstimator.early_stopping = property(cls.CrossValidationEstimator.get_early_stopping, cls.CrossValidationEstimator.set_early_stopping)
+    del cls.CrossValidationEstimator.get_early_stopping, cls.CrossValidationEstimator.set_early_stopping
+
 for cls in _Selection:
     selection_decorator(cls)
 
@@ -356,6 +399,54 @@ def normal_estimation(algo='ml', data=None, **kwargs):
                        dict(ml = NormalDistributionMLEstimation.Estimator),
                        **kwargs)
 
+def laplace_estimation(algo='ml', data=None, **kwargs):
+    """
+    """
+    return _estimation(algo, 
+                       data,
+                       dict(ml = LaplaceDistributionMLEstimation.Estimator),
+                       **kwargs)
+
+def logistic_estimation(algo='ml', data=None, **kwargs):
+    """
+    """
+    return _estimation(algo, 
+                       data,
+                       dict(ml = LogisticDistributionMLEstimation.Estimator),
+                       **kwargs)
+
+def cauchy_estimation(algo='ml', data=None, **kwargs):
+    """
+    """
+    return _estimation(algo, 
+                       data,
+                       dict(ml = CauchyDistributionMLEstimation.Estimator),
+                       **kwargs)
+
+def gumbel_max_estimation(algo='ml', data=None, **kwargs):
+    """
+    """
+    return _estimation(algo, 
+                       data,
+                       dict(ml = GumbelMaxDistributionMLEstimation.Estimator),
+                       **kwargs)
+
+def gumbel_min_estimation(algo='ml', data=None, **kwargs):
+    """
+    """
+    return _estimation(algo, 
+                       data,
+                       dict(ml = GumbelMinDistributionMLEstimation.Estimator),
+                       **kwargs)
+
+def student_estimation(algo='ml', data=None, **kwargs):
+    """
+    """
+    return _estimation(algo, 
+                       data,
+                       dict(ml = NonStandardStudentDistributionMLEstimation.Estimator),
+                       **kwargs)
+
 UnivariateHistogramDistributionEstimation.Estimator.nb_bins = property(UnivariateHistogramDistributionEstimation.Estimator.get_nb_bins, UnivariateHistogramDistributionEstimation.Estimator.set_nb_bins)
 del UnivariateHistogramDistributionEstimation.Estimator.get_nb_bins, UnivariateHistogramDistributionEstimation.Estimator.set_nb_bins
 
@@ -390,6 +481,9 @@ del MultivariateDistributionEstimation.get_estimated
 MultinomialSplittingDistributionEstimation.Estimator.sum = property(MultinomialSplittingDistributionEstimation.Estimator.get_sum, MultinomialSplittingDistributionEstimation.Estimator.set_sum)
 del MultinomialSplittingDistributionEstimation.Estimator.get_sum, MultinomialSplittingDistributionEstimation.Estimator.set_sum
 
+MultinomialSplittingDistributionEstimation.Estimator.compress = property(MultinomialSplittingDistributionEstimation.Estimator.get_compress, MultinomialSplittingDistributionEstimation.Estimator.set_compress)
+del MultinomialSplittingDistributionEstimation.Estimator.get_compress, MultinomialSplittingDistributionEstimation.Estimator.set_compress
+
 def multinomial_splitting_estimation(data=None, **kwargs):
     mapping = dict(dflt = MultinomialSplittingDistributionEstimation.Estimator)
     return _estimation('dflt', data, mapping, **kwargs)
@@ -403,6 +497,14 @@ def independent_multivariate_distribution_estimation_decorator(cls):
 for cls in _IndependentMultivariateDistributionEstimation:
     independent_multivariate_distribution_estimation_decorator(cls)
 
+def independent_multivariate_distribution_estimator_decorator(cls):
+
+    cls.default_estimator = property(cls.get_default_estimator, cls.set_default_estimator)
+    del cls.get_default_estimator, cls.set_default_estimator
+
+for cls in _IndependentMultivariateDistributionEstimation:
+    independent_multivariate_distribution_estimator_decorator(cls.Estimator)
+
 def independent_estimation(data, **kwargs):
     if isinstance(data, MultivariateData):
         if all(component.sample_space.outcome is outcome_type.CATEGORICAL for component in data.components):
@@ -440,6 +542,20 @@ def mixture_distribution_em_estimator_decorator(cls):
 for cls in _MixtureDistributionEMEstimation:
     mixture_distribution_em_estimator_decorator(cls.Estimator)
 
+def mixture_distribution_em_selection_estimator_decorator(cls):
+
+    cls.threshold = property(cls.get_threshold, cls.set_threshold)
+    del cls.get_threshold, cls.set_threshold
+
+for cls in [CategoricalUnivariateMixtureDistributionEMSelection,
+            DiscreteUnivariateMixtureDistributionEMSelection,
+            ContinuousUnivariateMixtureDistributionEMSelection,
+            MixedMultivariateMixtureDistributionEMSelection,
+            CategoricalMultivariateMixtureDistributionEMSelection,
+            DiscreteMultivariateMixtureDistributionEMSelection,
+            ContinuousMultivariateMixtureDistributionEMSelection]:
+    mixture_distribution_em_selection_estimator_decorator(cls.Estimator)
+
 def mixture_estimation(data, algo='em', **kwargs):
     if isinstance(data, UnivariateData):
         outcome = data.sample_space.outcome
@@ -462,24 +578,47 @@ def mixture_estimation(data, algo='em', **kwargs):
     mult = kwargs.pop('mult', outcome is outcome_type.MIXED)
     if mult:
         if outcome is outcome_type.MIXED:
-            mapping = dict(em = MixedMultivariateMixtureDistributionEMEstimation.Estimator)
+            mapping = dict(em = MixedMultivariateMixtureDistributionEMEstimation.Estimator,
+                           cem = MixedMultivariateMixtureDistributionCEMEstimation.Estimator,
+                           sel = MixedMultivariateMixtureDistributionEMSelection.Estimator)
         elif outcome is outcome_type.CATEGORICAL:
-            mapping = dict(em = CategoricalMultivariateMixtureDistributionEMEstimation.Estimator)
+            mapping = dict(em = CategoricalMultivariateMixtureDistributionEMEstimation.Estimator,
+                           cem = CategoricalMultivariateMixtureDistributionCEMEstimation.Estimator,
+                           sel = CategoricalMultivariateMixtureDistributionEMSelection.Estimator)
         elif outcome is outcome_type.DISCRETE:
-            mapping = dict(em = DiscreteMultivariateMixtureDistributionEMEstimation.Estimator)
+            mapping = dict(em = DiscreteMultivariateMixtureDistributionEMEstimation.Estimator,
+                           cem = DiscreteMultivariateMixtureDistributionCEMEstimation.Estimator,
+                           sel = DiscreteMultivariateMixtureDistributionEMSelection.Estimator)
         elif outcome is outcome_type.CONTINUOUS:
-            mapping = dict(em = ContinuousMultivariateMixtureDistributionEMEstimation.Estimator)
+            mapping = dict(em = ContinuousMultivariateMixtureDistributionEMEstimation.Estimator,
+                           cem = ContinuousMultivariateMixtureDistributionCEMEstimation.Estimator,
+                           sel = ContinuousMultivariateMixtureDistributionEMSelection.Estimator)
     else:
         if outcome is outcome_type.MIXED:
             raise ValueError('\'mult\' parameter')
         elif outcome is outcome_type.CATEGORICAL:
-            mapping = dict(em = CategoricalUnivariateMixtureDistributionEMEstimation.Estimator)
+            mapping = dict(em = CategoricalUnivariateMixtureDistributionEMEstimation.Estimator,
+                           cem = CategoricalUnivariateMixtureDistributionCEMEstimation.Estimator,
+                           sel = CategoricalUnivariateMixtureDistributionEMSelection.Estimator)
         elif outcome is outcome_type.DISCRETE:
-            mapping = dict(em = DiscreteUnivariateMixtureDistributionEMEstimation.Estimator)
+            mapping = dict(em = DiscreteUnivariateMixtureDistributionEMEstimation.Estimator,
+                           cem = DiscreteUnivariateMixtureDistributionCEMEstimation.Estimator,
+                           sel = DiscreteUnivariateMixtureDistributionEMSelection.Estimator)
         elif outcome is outcome_type.CONTINUOUS:
-            mapping = dict(em = MixedMultivariateMixtureDistributionEMEstimation.Estimator)
+            mapping = dict(em = ContinuousUnivariateMixtureDistributionEMEstimation.Estimator,
+                           cem = ContinuousUnivariateMixtureDistributionCEMEstimation.Estimator,
+                           sel = ContinuousUnivariateMixtureDistributionEMSelection.Estimator)
     return _estimation(algo, data, mapping, **kwargs)
 
+def slope_heuristic_selection_estimator_decorator(cls):
+
+    cls.lazy_proposals = property(cls.get_lazy_proposals, cls.set_lazy_proposals)
+    del cls.get_lazy_proposals, cls.set_lazy_proposals
+
+for cls in [DiscreteUnivariateDistributionSlopeHeuristicSelection,
+            ContinuousUnivariateDistributionSlopeHeuristicSelection]:
+    slope_heuristic_selection_estimator_decorator(cls.Estimator)
+
 def selection(data, algo="criterion", *args, **kwargs):
     if isinstance(data, UnivariateData):
         outcome = data.sample_space.outcome
@@ -502,20 +641,65 @@ def selection(data, algo="criterion", *args, **kwargs):
     mult = kwargs.pop('mult', outcome is outcome_type.MIXED)
     if mult:
         if outcome is outcome_type.MIXED:
-            mapping = dict(criterion = MultivariateDistributionSelection.CriterionEstimator)
+            mapping = dict(criterion = MixedMultivariateDistributionSelection.CriterionEstimator,
+                           cv = MixedMultivariateDistributionSelection.CrossValidationEstimator)
         elif outcome is outcome_type.CATEGORICAL:
-            mapping = dict(criterion = CategoricalMultivariateDistributionSelection.CriterionEstimator)
+            mapping = dict(criterion = CategoricalMultivariateDistributionSelection.CriterionEstimator,
+                           cv = CategoricalMultivariateDistributionSelection.CrossValidationEstimator)
         elif outcome is outcome_type.DISCRETE:
-            mapping = dict(criterion = DiscreteMultivariateDistributionSelection.CriterionEstimator)
+            mapping = dict(criterion = DiscreteMultivariateDistributionSelection.CriterionEstimator,
+                           cv = DiscreteMultivariateDistributionSelection.CrossValidationEstimator)
         elif outcome is outcome_type.CONTINUOUS:
-            mapping = dict(criterion = ContinuousMultivariateDistributionSelection.CriterionEstimator)
+            mapping = dict(criterion = ContinuousMultivariateDistributionSelection.CriterionEstimator,
+                           cv = ContinuousMultivariateDistributionSelection.CrossValidationEstimator)
     else:
         if outcome is outcome_type.MIXED:
             raise ValueError('\'mult\' parameter')
         elif outcome is outcome_type.CATEGORICAL:
-            mapping = dict(criterion = CategoricalUnivariateDistributionSelection.CriterionEstimator)
+            mapping = dict(criterion = CategoricalUnivariateDistributionSelection.CriterionEstimator,
+                           cv = CategoricalUnivariateDistributionSelection.CrossValidationEstimator)
         elif outcome is outcome_type.DISCRETE:
-            mapping = dict(criterion = DiscreteUnivariateDistributionSelection.CriterionEstimator)
+            mapping = dict(criterion = DiscreteUnivariateDistributionSelection.CriterionEstimator,
+                           cv = DiscreteUnivariateDistributionSelection.CrossValidationEstimator,
+                           sh = DiscreteUnivariateDistributionSlopeHeuristicSelection.Estimator)
         elif outcome is outcome_type.CONTINUOUS:
-            mapping = dict(criterion = ContinuousUnivariateDistributionSelection.CriterionEstimator)
-    return _estimation(algo, data, mapping, **kwargs)
\ No newline at end of file
+            mapping = dict(criterion = ContinuousUnivariateDistributionSelection.CriterionEstimator,
+                           cv = ContinuousUnivariateDistributionSelection.CrossValidationEstimator,
+                           sh = ContinuousUnivariateDistributionSlopeHeuristicSelection.Estimator)
+    return _estimation(algo, data, mapping, **kwargs)
+
+def cached_estimator_decorator(cls):
+
+    cls.estimator = property(cls.get_estimator, cls.set_estimator)
+    del cls.get_estimator, cls.set_estimator
+
+    cls.capacity = property(cls.get_capacity, cls.set_capacity)
+    del cls.get_capacity, cls.set_capacity
+
+for cls in [CategoricalUnivariateDistributionCachedEstimator,
+            DiscreteUnivariateDistributionCachedEstimator,
+            ContinuousUnivariateDistributionCachedEstimator,
+            MixedMultivariateDistributionCachedEstimator,
+            CategoricalMultivariateDistributionCachedEstimator,
+            DiscreteMultivariateDistributionCachedEstimator,
+            ContinuousMultivariateDistributionCachedEstimator]:
+    cached_estimator_decorator(cls)
+
+def cached_estimation(estimator, data=None, **kwargs):
+    if isinstance(estimator, CategoricalUnivariateDistributionEstimation.Estimator):
+        cls = CategoricalUnivariateDistributionCachedEstimator
+    elif isinstance(estimator, DiscreteUnivariateDistributionEstimation.Estimator):
+        cls = DiscreteUnivariateDistributionCachedEstimator
+    elif isinstance(estimator, ContinuousUnivariateDistributionEstimation.Estimator):
+        cls = ContinuousUnivariateDistributionCachedEstimator
+    elif isinstance(estimator, CategoricalMultivariateDistributionEstimation.Estimator):
+        cls = CategoricalMultivariateDistributionCachedEstimator
+    elif isinstance(estimator, DiscreteMultivariateDistributionEstimation.Estimator):
+        cls = DiscreteMultivariateDistributionCachedEstimator
+    elif isinstance(estimator, ContinuousMultivariateDistributionEstimation.Estimator):
+        cls = ContinuousMultivariateDistributionCachedEstimator
+    elif isinstance(estimator, MultivariateDistributionEstimation.Estimator):
+        cls = MixedMultivariateDistributionCachedEstimator
+    else:
+        raise TypeError('\'estimator\' parameter')
+    return _estimation('dflt', data, dict(dflt = lambda : cls(estimator)), **kwargs)
@@ -11,12 +11,28 @@ from functools import wraps
 import statiskit.core._core
 from statiskit.core.__core.statiskit import (MeanEstimation,
                                                  NaturalMeanEstimation,
+                                                 StreamingMeanEstimation,
                                              MeanVectorEstimation,
                                                  NaturalMeanVectorEstimation,
+                                                 StreamingMeanVectorEstimation,
                                              VarianceEstimation,
                                                  NaturalVarianceEstimation,
+                                                 StreamingVarianceEstimation,
                                              CovarianceMatrixEstimation,
-                                                 NaturalCovarianceMatrixEstimation)
+                                                 NaturalCovarianceMatrixEstimation,
+                                                 StreamingCovarianceMatrixEstimation,
+                                             SkewnessEstimation,
+                                                 NaturalSkewnessEstimation,
+                                             KurtosisEstimation,
+                                                 NaturalKurtosisEstimation,
+                                             CoSkewnessMatrixEstimation,
+                                                 NaturalCoSkewnessMatrixEstimation,
+                                             CoKurtosisMatrixEstimation,
+                                                 NaturalCoKurtosisMatrixEstimation,
+                                             QuantileEstimation,
+                                                 NaturalQuantileEstimation,
+                                                 SelectionQuantileEstimation,
+                                                 StreamingQuantileEstimation)
 __all__ = []
 
 MeanEstimation.mean = property(MeanEstimation.get_mean)
@@ -37,6 +53,27 @@ del VarianceEstimation.get_variance
 CovarianceMatrixEstimation.covariance = property(CovarianceMatrixEstimation.get_covariance)
 del CovarianceMatrixEstimation.get_covariance
 
+SkewnessEstimation.skewness = property(SkewnessEstimation.get_skewness)
+del SkewnessEstimation.get_skewness
+
+KurtosisEstimation.kurtosis = property(KurtosisEstimation.get_kurtosis)
+del KurtosisEstimation.get_kurtosis
+
+CoSkewnessMatrixEstimation.coskewness = property(CoSkewnessMatrixEstimation.get_coskewness)
+del CoSkewnessMatrixEstimation.get_coskewness
+
+CoKurtosisMatrixEstimation.cokurtosis = property(CoKurtosisMatrixEstimation.get_cokurtosis)
+del CoKurtosisMatrixEstimation.get_cokurtosis
+
+QuantileEstimation.median = property(QuantileEstimation.get_median)
+del QuantileEstimation.get_median
+
+QuantileEstimation.quantile = QuantileEstimation.get_quantile
+del QuantileEstimation.get_quantile
+
+QuantileEstimation.quantiles = QuantileEstimation.get_quantiles
+del QuantileEstimation.get_quantiles
+
 def __str__(self):
     return str(self.mean)
 
@@ -89,7 +126,8 @@ del __repr__
 def mean_estimation(algo='nat', data=None, **kwargs):
     """
     """
-    mapping = dict(nat = NaturalMeanEstimation.Estimator)
+    mapping = dict(nat = NaturalMeanEstimation.Estimator,
+                   str = StreamingMeanEstimation.Estimator)
     try:
         algo = mapping[algo]()
     except KeyError:
@@ -107,7 +145,8 @@ def mean_estimation(algo='nat', data=None, **kwargs):
 def mean_vector_estimation(algo='nat', data=None, **kwargs):
     """
     """
-    mapping = dict(nat = NaturalMeanVectorEstimation.Estimator)
+    mapping = dict(nat = NaturalMeanVectorEstimation.Estimator,
+                   str = StreamingMeanVectorEstimation.Estimator)
     try:
         algo = mapping[algo]()
     except KeyError:
@@ -125,13 +164,23 @@ def mean_vector_estimation(algo='nat', data=None, **kwargs):
 NaturalVarianceEstimation.Estimator.bias = property(NaturalVarianceEstimation.Estimator.get_bias, NaturalVarianceEstimation.Estimator.set_bias)
 del NaturalVarianceEstimation.Estimator.get_bias, NaturalVarianceEstimation.Estimator.set_bias
 
+StreamingVarianceEstimation.Estimator.bias = property(StreamingVarianceEstimation.Estimator.get_bias, StreamingVarianceEstimation.Estimator.set_bias)
+del StreamingVarianceEstimation.Estimator.get_bias, StreamingVarianceEstimation.Estimator.set_bias
+
 NaturalCovarianceMatrixEstimation.Estimator.bias = property(NaturalCovarianceMatrixEstimation.Estimator.get_bias, NaturalCovarianceMatrixEstimation.Estimator.set_bias)
 del NaturalCovarianceMatrixEstimation.Estimator.get_bias, NaturalCovarianceMatrixEstimation.Estimator.set_bias
 
+StreamingCovarianceMatrixEstimation.Estimator.bias = property(StreamingCovarianceMatrixEstimation.Estimator.get_bias, StreamingCovarianceMatrixEstimation.Estimator.set_bias)
+del StreamingCovarianceMatrixEstimation.Estimator.get_bias, StreamingCovarianceMatrixEstimation.Estimator.set_bias
+
+NaturalCovarianceMatrixEstimation.Estimator.block = property(NaturalCovarianceMatrixEstimation.Estimator.get_block, NaturalCovarianceMatrixEstimation.Estimator.set_block)
+del NaturalCovarianceMatrixEstimation.Estimator.get_block, NaturalCovarianceMatrixEstimation.Estimator.set_block
+
 def variance_estimation(algo='nat', data=None, **kwargs):
     """
     """
-    mapping = dict(nat = NaturalVarianceEstimation.Estimator)
+    mapping = dict(nat = NaturalVarianceEstimation.Estimator,
+                   str = StreamingVarianceEstimation.Estimator)
     try:
         algo = mapping[algo]()
     except KeyError:
@@ -149,7 +198,8 @@ def variance_estimation(algo='nat', data=None, **kwargs):
 def covariance_matrix_estimation(algo='nat', data=None, **kwargs):
     """
     """
-    mapping = dict(nat = NaturalCovarianceMatrixEstimation.Estimator)
+    mapping = dict(nat = NaturalCovarianceMatrixEstimation.Estimator,
+                   str = StreamingCovarianceMatrixEstimation.Estimator)
     try:
         algo = mapping[algo]()
     except KeyError:
@@ -163,3 +213,101 @@ def covariance_matrix_estimation(algo='nat', data=None, **kwargs):
         return algo(data, data.mean)
     else:
         return algo
+
+def skewness_estimation(algo='nat', data=None, **kwargs):
+    """
+    """
+    mapping = dict(nat = NaturalSkewnessEstimation.Estimator)
+    try:
+        algo = mapping[algo]()
+    except KeyError:
+        raise ValueError('\'algo\' parameter, possible values are ' + ', '.join('"' + algo + '"' for algo in mapping.iterkeys()))
+    except:
+        raise
+    for attr in kwargs.keys():
+        if hasattr(algo, attr):
+            setattr(algo, attr, kwargs.pop(attr))
+    if data:
+        return algo(data)
+    else:
+        return algo
+
+def kurtosis_estimation(algo='nat', data=None, **kwargs):
+    """
+    """
+    mapping = dict(nat = NaturalKurtosisEstimation.Estimator)
+    try:
+        algo = mapping[algo]()
+    except KeyError:
+        raise ValueError('\'algo\' parameter, possible values are ' + ', '.join('"' + algo + '"' for algo in mapping.iterkeys()))
+    except:
+        raise
+    for attr in kwargs.keys():
+        if hasattr(algo, attr):
+            setattr(algo, attr, kwargs.pop(attr))
+    if data:
+        return algo(data)
+    else:
+        return algo
+
+def coskewness_matrix_estimation(algo='nat', data=None, **kwargs):
+    """
+    """
+    mapping = dict(nat = NaturalCoSkewnessMatrixEstimation.Estimator)
+    try:
+        algo = mapping[algo]()
+    except KeyError:
+        raise ValueError('\'algo\' parameter, possible values are ' + ', '.join('"' + algo + '"' for algo in mapping.iterkeys()))
+    except:
+        raise
+    for attr in kwargs.keys():
+        if hasattr(algo, attr):
+            setattr(algo, attr, kwargs.pop(attr))
+    if data:
+        return algo(data)
+    else:
+        return algo
+
+def cokurtosis_matrix_estimation(algo='nat', data=None, **kwargs):
+    """
+    """
+    mapping = dict(nat = NaturalCoKurtosisMatrixEstimation.Estimator)
+    try:
+        algo = mapping[algo]()
+    except KeyError:
+        raise ValueError('\'algo\' parameter, possible values are ' + ', '.join('"' + algo + '"' for algo in mapping.iterkeys()))
+    except:
+        raise
+    for attr in kwargs.keys():
+        if hasattr(algo, attr):
+            setattr(algo, attr, kwargs.pop(attr))
+    if data:
+        return algo(data)
+    else:
+        return algo
+
+SelectionQuantileEstimation.Estimator.probabilities = property(SelectionQuantileEstimation.Estimator.get_probabilities, SelectionQuantileEstimation.Estimator.set_probabilities)
+del SelectionQuantileEstimation.Estimator.get_probabilities, SelectionQuantileEstimation.Estimator.set_probabilities
+
+StreamingQuantileEstimation.Estimator.compression = property(StreamingQuantileEstimation.Estimator.get_compression, StreamingQuantileEstimation.Estimator.set_compression)
+del StreamingQuantileEstimation.Estimator.get_compression, StreamingQuantileEstimation.Estimator.set_compression
+
+def quantile_estimation(algo='nat', data=None, **kwargs):
+    """
+    """
+    mapping = dict(nat = NaturalQuantileEstimation.Estimator,
+                   sel = SelectionQuantileEstimation.Estimator,
+                   str = StreamingQuantileEstimation.Estimator)
+    try:
+        algo = mapping[algo]()
+    except KeyError:
+        raise ValueError('\'algo\' parameter, possible values are ' + ', '.join('"' + algo + '"' for algo in mapping.iterkeys()))
+    except:
+        raise
+    for attr in kwargs.keys():
+        if hasattr(algo, attr):
+            setattr(algo, attr, kwargs.pop(attr))
+    if data:
+        return algo(data)
+    else:
+        return algo
@@ -10,9 +10,13 @@ from functools import wraps
 from optionals import pyplot
 
 import statiskit.core._core
-from statiskit.core.__core.statiskit import SlopeHeuristic, _SlopeHeuristicSelection
+from statiskit.core.__core.statiskit import (SlopeHeuristic, _SlopeHeuristicSelection,
+                                             SlopeHeuristicOLSSolver, SlopeHeuristicHuberSolver, SlopeHeuristicBiSquareSolver,
+                                             SlopeHeuristicMaximalSelector, SlopeHeuristicSuperiorSelector)
 
-__all__ = ['SlopeHeuristic']
+__all__ = ['SlopeHeuristic',
+           'SlopeHeuristicOLSSolver', 'SlopeHeuristicHuberSolver', 'SlopeHeuristicBiSquareSolver',
+           'SlopeHeuristicMaximalSelector', 'SlopeHeuristicSuperiorSelector']
 
 class Proxy(object):
 
@@ -189,5 +193,5 @@ def slope_heuristic_selection_decorator(cls):
     del cls.get_proposal
     cls.proposals = property(Proposals)
 
-for cls in (_SlopeHeuristicSelection,):
+for cls in _SlopeHeuristicSelection:
     slope_heuristic_selection_decorator(cls)
\ No newline at end of file
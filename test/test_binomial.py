@@ -22,6 +22,16 @@ class TestBinomial(unittest.TestCase, AbstractTestDiscreteUnivariateDistribution
         mle = core.binomial_estimation('ml', data)
         self.assertGreaterEqual(mle.estimated.loglikelihood(data), self._dist.loglikelihood(data))
 
+    def test_mle_profile(self):
+        """Test binomial ML estimation maximizes the profile likelihood"""
+        data = core.BinomialDistribution(15, .3).simulation(100)
+        mle = core.binomial_estimation('ml', data)
+        kappa = mle.estimated.kappa
+        llh = mle.estimated.loglikelihood(data)
+        for neighbour in [kappa - 1, kappa + 1]:
+            if neighbour > 0 and neighbour >= max(event.value for event in data.events):
+                self.assertGreaterEqual(llh, core.BinomialDistribution(neighbour, data.mean / neighbour).loglikelihood(data))
+
     def test_mme(self):
         """Test binomial MM estimation"""
         data = self._dist.simulation(20)
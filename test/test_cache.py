@@ -0,0 +1,50 @@
+from statiskit import core
+
+import unittest
+from nose.plugins.attrib import attr
+
+@attr(linux=True,
+      osx=True,
+      win=True,
+      level=1)
+class TestCache(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        """Test cached estimator construction"""
+        cls._data = core.NegativeBinomialDistribution(2., .5).simulation(100)
+        cls._estimator = core.cached_estimation(core.negative_binomial_estimation('ml'), capacity=2)
+
+    def test_hit(self):
+        """Test cached estimation of the same data"""
+        self._estimator.clear()
+        estimation = self._estimator(self._data, True)
+        self.assertEqual(self._estimator.size(), 1)
+        _estimation = self._estimator(self._data.copy(), True)
+        self.assertEqual(self._estimator.size(), 1)
+        self.assertEqual(estimation.estimated.loglikelihood(self._data), _estimation.estimated.loglikelihood(self._data))
+
+    def test_capacity(self):
+        """Test cached estimation eviction"""
+        self._estimator.clear()
+        for size in [50, 100, 150]:
+            self._estimator(core.NegativeBinomialDistribution(2., .5).simulation(size), True)
+        self.assertEqual(self._estimator.size(), 2)
+
+    def test_setting(self):
+        """Test cached estimation after a change of setting"""
+        data = core.NormalDistribution().simulation(100)
+        cached = core.cached_estimation(core.histogram_estimation(False, 'cla', nb_bins=5))
+        loglikelihood = cached(data, True).estimated.loglikelihood(data)
+        estimator = cached.estimator
+        estimator.nb_bins = 10
+        self.assertEqual(cached(data, True).estimated.loglikelihood(data), loglikelihood)
+        cached.estimator = estimator
+        self.assertEqual(cached.size(), 0)
+        self.assertEqual(cached(data, True).estimated.loglikelihood(data), estimator(data, True).estimated.loglikelihood(data))
+        self.assertNotEqual(cached(data, True).estimated.loglikelihood(data), loglikelihood)
+
+    @classmethod
+    def tearDownClass(cls):
+        """Test cached estimator deletion"""
+        del cls._data, cls._estimator
@@ -0,0 +1,28 @@
+from test_distribution import AbstractTestContinuousUnivariateDistribution
+
+from statiskit import core
+
+import unittest
+from nose.plugins.attrib import attr
+
+@attr(linux=True,
+      osx=True,
+      win=True,
+      level=1)
+class TestCauchy(unittest.TestCase, AbstractTestContinuousUnivariateDistribution):
+
+    @classmethod
+    def setUpClass(cls):
+        """Test Cauchy distribution construction"""
+        cls._dist = core.CauchyDistribution(1., 2.)
+
+    def test_mle(self):
+        """Test Cauchy ML estimation"""
+        data = self._dist.simulation(100)
+        mle = core.cauchy_estimation('ml', data)
+        self.assertGreaterEqual(mle.estimated.loglikelihood(data), self._dist.loglikelihood(data))
+
+    @classmethod
+    def tearDownClass(cls):
+        """Test Cauchy distribution deletion"""
+        del cls._dist
\ No newline at end of file
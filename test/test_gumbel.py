@@ -0,0 +1,50 @@
+from test_distribution import AbstractTestContinuousUnivariateDistribution
+
+from statiskit import core
+
+import unittest
+from nose.plugins.attrib import attr
+
+@attr(linux=True,
+      osx=True,
+      win=True,
+      level=1)
+class TestGumbelMax(unittest.TestCase, AbstractTestContinuousUnivariateDistribution):
+
+    @classmethod
+    def setUpClass(cls):
+        """Test Gumbel max distribution construction"""
+        cls._dist = core.GumbelMaxDistribution(1., 2.)
+
+    def test_mle(self):
+        """Test Gumbel max ML estimation"""
+        data = self._dist.simulation(100)
+        mle = core.gumbel_max_estimation('ml', data)
+        self.assertGreaterEqual(mle.estimated.loglikelihood(data), self._dist.loglikelihood(data))
+
+    @classmethod
+    def tearDownClass(cls):
+        """Test Gumbel max distribution deletion"""
+        del cls._dist
+
+@attr(linux=True,
+      osx=True,
+      win=True,
+      level=1)
+class TestGumbelMin(unittest.TestCase, AbstractTestContinuousUnivariateDistribution):
+
+    @classmethod
+    def setUpClass(cls):
+        """Test Gumbel min distribution construction"""
+        cls._dist = core.GumbelMinDistribution(1., 2.)
+
+    def test_mle(self):
+        """Test Gumbel min ML estimation"""
+        data = self._dist.simulation(100)
+        mle = core.gumbel_min_estimation('ml', data)
+        self.assertGreaterEqual(mle.estimated.loglikelihood(data), self._dist.loglikelihood(data))
+
+    @classmethod
+    def tearDownClass(cls):
+        """Test Gumbel min distribution deletion"""
+        del cls._dist
\ No newline at end of file
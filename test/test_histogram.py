@@ -3,6 +3,7 @@ from test_distribution import AbstractTestContinuousUnivariateDistribution
 from statiskit import core
 
 import unittest
+import numpy
 from nose.plugins.attrib import attr
 
 # @attr(linux=True,
@@ -37,4 +38,47 @@ from nose.plugins.attrib import attr
 #     @classmethod
 #     def tearDownClass(cls):
 #         """Test distribution deletion"""
-#         del cls._dist
\ No newline at end of file
+#         del cls._dist
+@attr(linux=True,
+      osx=True,
+      win=True,
+      level=1)
+class TestHistogramSelection(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        """Test histogram selection data construction"""
+        cls._data = core.NormalDistribution().simulation(100)
+
+    def test_regular(self):
+        """Test regular histogram slope heuristic scores"""
+        shs = core.histogram_estimation(self._data, algo='reg', maxbins=20)
+        self.assertGreater(len(shs.proposals), 0)
+        for index in range(len(shs.proposals)):
+            self.assertAlmostEqual(shs.scores[index], shs.proposals[index].loglikelihood(self._data))
+
+    def test_irregular(self):
+        """Test irregular histogram slope heuristic proposals"""
+        shs = core.histogram_estimation(self._data, algo='irr', maxbins=20)
+        self.assertGreater(len(shs.proposals), 0)
+        loglikelihoods = [proposal.loglikelihood(self._data) for proposal in shs.proposals[:]]
+        for index in range(len(loglikelihoods) - 1):
+            self.assertLessEqual(loglikelihoods[index], loglikelihoods[index + 1] + 1e-7)
+
+    def test_moments(self):
+        """Test histogram mean, variance and cumulative distribution function"""
+        dist = core.histogram_estimation(self._data, algo='cla', nb_bins=10).estimated
+        lower, upper = dist.quantile(0.) - 1., dist.quantile(1.) + 1.
+        values = numpy.linspace(lower, upper, num=20001)
+        densities = numpy.array([dist.pdf(value) for value in values])
+        self.assertAlmostEqual(numpy.trapz(densities, values), 1., places=2)
+        mean = numpy.trapz(values * densities, values)
+        self.assertAlmostEqual(dist.mean, mean, places=2)
+        self.assertAlmostEqual(dist.variance, numpy.trapz((values - mean) ** 2 * densities, values), places=2)
+        self.assertAlmostEqual(dist.cdf(upper), 1.)
+        self.assertEqual(dist.cdf(lower), 0.)
+
+    @classmethod
+    def tearDownClass(cls):
+        """Test histogram selection data deletion"""
+        del cls._data
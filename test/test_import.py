@@ -0,0 +1,22 @@
+import unittest
+from nose.plugins.attrib import attr
+
+@attr(linux=True,
+      osx=True,
+      win=True,
+      level=1)
+class TestImport(unittest.TestCase):
+
+    def test_core(self):
+        """Test package import"""
+        from statiskit import core
+        from statiskit.core import estimation
+        for name in ['selection', 'cached_estimation', 'mixture_estimation', 'histogram_estimation']:
+            self.assertTrue(hasattr(core, name))
+        self.assertTrue(hasattr(estimation.DiscreteUnivariateDistributionCachedEstimator, 'capacity'))
+        self.assertTrue(hasattr(estimation.DiscreteUnivariateDistributionSlopeHeuristicSelection.Estimator, 'lazy_proposals'))
+
+    def test_moment(self):
+        """Test moment module import"""
+        from statiskit.core import moment
+        self.assertTrue(hasattr(moment, 'quantile_estimation'))
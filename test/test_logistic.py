@@ -16,6 +16,12 @@ class TestLogistic(unittest.TestCase, AbstractTestContinuousUnivariateDistributi
         """Test logistic distribution construction"""
         cls._dist = core.LogisticDistribution()
 
+    def test_mle(self):
+        """Test logistic ML estimation"""
+        data = self._dist.simulation(100)
+        mle = core.logistic_estimation('ml', data)
+        self.assertGreaterEqual(mle.estimated.loglikelihood(data), self._dist.loglikelihood(data))
+
     @classmethod
     def tearDownClass(cls):
         """Test logistic distribution deletion"""
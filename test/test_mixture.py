@@ -3,6 +3,7 @@ from test_distribution import AbstractTestDiscreteUnivariateDistribution
 from statiskit import linalg
 from statiskit import core
 
+import math
 import unittest
 from nose.plugins.attrib import attr
 
@@ -33,5 +34,95 @@ class TestMixture(unittest.TestCase, AbstractTestDiscreteUnivariateDistribution)
             curr = dist.loglikelihood(data)
             self.assertGreaterEqual(curr, prev)
 
+    def test_estimation_cem(self):
+        """Test mixture estimation using the classification EM algorithm"""
+        data = self._dist.simulation(100)
+        cem = core.mixture_estimation(data, 'cem',
+                                      initializator = core.MixtureDistribution(core.PoissonDistribution(3.),
+                                                                               core.PoissonDistribution(5.),
+                                                                               pi = linalg.Vector([.5, .5])),
+                                      default_estimator = core.poisson_estimation('ml'))
+        values = [event.value for event in data.events]
+        curr = -float("inf")
+        for index, dist in enumerate(cem.iterations):
+            prev = curr
+            curr = dist.loglikelihood(data)
+            for value in values:
+                posterior = dist.posterior(value)
+                curr += math.log(max(posterior[state] for state in range(dist.nb_states)))
+            self.assertGreaterEqual(curr, prev)
+            if index > 0:
+                assignements = [cem.iterations[index - 1].assignement(value) for value in values]
+                for state in range(dist.nb_states):
+                    partition = [value for value, assignement in zip(values, assignements) if assignement == state]
+                    self.assertAlmostEqual(dist.pi[state], len(partition) / float(len(values)))
+                    self.assertAlmostEqual(dist.observations[state].theta, sum(partition) / float(len(partition)))
+        with self.assertRaises(RuntimeError):
+            core.mixture_estimation(data, 'cem',
+                                    initializator = core.MixtureDistribution(core.PoissonDistribution(3.),
+                                                                             core.PoissonDistribution(500.),
+                                                                             pi = linalg.Vector([.5, .5])),
+                                    default_estimator = core.poisson_estimation('ml'))
+
     def test_posterior(self):
         """Test mixture posterior probabilities"""
+        data = self._dist.simulation(20)
+        values = [event.value for event in data.events]
+        nb_threads = core.get_nb_threads()
+        for threads in [1, 3]:
+            core.set_nb_threads(threads)
+            posterior = self._dist.posterior(data)
+            shifted = self._dist.posterior(data, log=True)
+            log_posterior = self._dist.log_posterior(data)
+            assignements = self._dist.assignement(data)
+            uncertainties = self._dist.uncertainties(data)
+            for index, value in enumerate(values):
+                _posterior = self._dist.posterior(value)
+                _shifted = self._dist.posterior(value, log=True)
+                _log_posterior = self._dist.log_posterior(value)
+                self.assertEqual(max(_shifted[state] for state in range(self._dist.nb_states)), 0.)
+                for state in range(self._dist.nb_states):
+                    self.assertAlmostEqual(posterior[index, state], _posterior[state])
+                    self.assertAlmostEqual(shifted[index, state], _shifted[state])
+                    self.assertAlmostEqual(log_posterior[index, state], _log_posterior[state])
+                    self.assertAlmostEqual(math.exp(_log_posterior[state]), _posterior[state])
+                self.assertEqual(assignements[index], self._dist.assignement(value))
+                self.assertAlmostEqual(uncertainties[index], self._dist.uncertainty(value))
+            self.assertAlmostEqual(self._dist.uncertainty(data), sum(uncertainties[index] for index in range(len(values))))
+        core.set_nb_threads(nb_threads)
+
+    def test_quantiles(self):
+        """Test vectorized mixture quantiles"""
+        probabilities = [1e-12, 1e-9, 1e-6, .025, .3, .5, .5, .975, 1 - 1e-6, 1 - 1e-9, .05]
+        dist = core.MixtureDistribution(core.PoissonDistribution(.5),
+                                        core.PoissonDistribution(10.),
+                                        core.NegativeBinomialDistribution(2., .3),
+                                        pi = linalg.Vector([.25, .5, .25]))
+        quantiles = dist.quantile(probabilities)
+        for index, p in enumerate(probabilities):
+            self.assertEqual(quantiles[index], dist.quantile(p))
+            self.assertGreaterEqual(dist.cdf(quantiles[index]), p)
+            self.assertLess(dist.cdf(quantiles[index] - 1), p)
+        dist = core.MixtureDistribution(core.NormalDistribution(0., 1.),
+                                        core.NormalDistribution(5., 2.),
+                                        core.CauchyDistribution(-3., .5),
+                                        pi = linalg.Vector([.25, .5, .25]))
+        quantiles = dist.quantile(probabilities)
+        for index, p in enumerate(probabilities):
+            q = dist.quantile(p)
+            self.assertAlmostEqual(quantiles[index], q, delta = 1e-6 * max(1., abs(q)))
+
+    def test_selection_em(self):
+        """Test mixture number of components selection using the EM algorithm"""
+        data = self._dist.simulation(100)
+        sel = core.mixture_estimation(data, 'sel',
+                                      initializator = core.MixtureDistribution(core.PoissonDistribution(1.),
+                                                                               core.PoissonDistribution(3.),
+                                                                               core.PoissonDistribution(5.),
+                                                                               core.PoissonDistribution(8.),
+                                                                               pi = linalg.Vector([.25, .25, .25, .25])),
+                                      default_estimator = core.poisson_estimation('ml'))
+        self.assertGreaterEqual(len(sel.scores), 2)
+        self.assertLessEqual(sel.estimated.nb_states, 4)
+        for index in range(len(sel.scores) - 1):
+            self.assertGreater(sel.estimations[index].estimated.nb_states, sel.estimations[index + 1].estimated.nb_states)
@@ -0,0 +1,103 @@
+from statiskit import linalg
+from statiskit import core
+from statiskit.core.moment import (mean_estimation,
+                                   variance_estimation,
+                                   mean_vector_estimation,
+                                   covariance_matrix_estimation,
+                                   skewness_estimation,
+                                   kurtosis_estimation,
+                                   coskewness_matrix_estimation,
+                                   cokurtosis_matrix_estimation,
+                                   quantile_estimation)
+
+import unittest
+from nose.plugins.attrib import attr
+
+@attr(linux=True,
+      osx=True,
+      win=True,
+      level=1)
+class TestMoment(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        """Test univariate and multivariate data construction"""
+        cls._udata = core.NormalDistribution(1., 2.).simulation(100)
+        cls._mdata = core.MultinormalDistribution(linalg.Vector([0., 1.]), linalg.Matrix([[1.0, 0.5],
+                                                                                          [0.5, 2.0]])).simulation(100)
+
+    def test_univariate(self):
+        """Test streaming mean and variance estimation"""
+        nb_threads = core.get_nb_threads()
+        for threads in [1, 3]:
+            core.set_nb_threads(threads)
+            self.assertAlmostEqual(mean_estimation('str', self._udata).mean, mean_estimation('nat', self._udata).mean)
+            for bias in [False, True]:
+                self.assertAlmostEqual(variance_estimation('str', self._udata, bias=bias).variance,
+                                       variance_estimation('nat', self._udata, bias=bias).variance)
+        core.set_nb_threads(nb_threads)
+
+    def test_multivariate(self):
+        """Test streaming mean vector and covariance matrix estimation"""
+        nb_threads = core.get_nb_threads()
+        for threads in [1, 3]:
+            core.set_nb_threads(threads)
+            mean = mean_vector_estimation('str', self._mdata).mean
+            _mean = mean_vector_estimation('nat', self._mdata).mean
+            covariance = covariance_matrix_estimation('str', self._mdata).covariance
+            _covariance = covariance_matrix_estimation('nat', self._mdata).covariance
+            for i in range(2):
+                self.assertAlmostEqual(mean[i], _mean[i])
+                for j in range(2):
+                    self.assertAlmostEqual(covariance[i, j], _covariance[i, j])
+        core.set_nb_threads(nb_threads)
+
+    def test_shape(self):
+        """Test skewness and kurtosis estimation"""
+        values = [event.value for event in self._udata.events]
+        mean = sum(values) / len(values)
+        moments = [sum((value - mean) ** order for value in values) / len(values) for order in [2, 3, 4]]
+        self.assertAlmostEqual(skewness_estimation('nat', self._udata).skewness, moments[1] / moments[0] ** 1.5)
+        self.assertAlmostEqual(kurtosis_estimation('nat', self._udata).kurtosis, moments[2] / moments[0] ** 2)
+
+    def test_comoment(self):
+        """Test co-skewness and co-kurtosis matrix estimation"""
+        nb_threads = core.get_nb_threads()
+        for threads in [1, 3]:
+            core.set_nb_threads(threads)
+            coskewness = coskewness_matrix_estimation('nat', self._mdata).coskewness
+            cokurtosis = cokurtosis_matrix_estimation('nat', self._mdata).cokurtosis
+            for i in range(2):
+                component = self._mdata.components[i]
+                self.assertAlmostEqual(coskewness[i, i], skewness_estimation('nat', component).skewness)
+                self.assertAlmostEqual(cokurtosis[i, i], kurtosis_estimation('nat', component).kurtosis)
+                self.assertAlmostEqual(cokurtosis[i, 1 - i], cokurtosis[1 - i, i])
+        core.set_nb_threads(nb_threads)
+
+    def test_quantile(self):
+        """Test natural and selection quantile estimation"""
+        data = core.UnivariateDataFrame(core.controls.RR)
+        for value in range(1, 11):
+            data.add_event(core.ContinuousElementaryEvent(float(value)))
+        nat = quantile_estimation('nat', data)
+        self.assertEqual(nat.median, 5.)
+        self.assertEqual(nat.quantile(.3), 3.)
+        self.assertEqual(nat.quantile(1.), 10.)
+        sel = quantile_estimation('sel', data, probabilities=linalg.Vector([.3, .5]))
+        self.assertEqual(sel.quantile(.1 + .2), 3.)
+        self.assertEqual(sel.median, 5.)
+        with self.assertRaises(RuntimeError):
+            sel.quantile(.9)
+
+    def test_streaming_quantile(self):
+        """Test streaming quantile estimation"""
+        data = core.NormalDistribution().simulation(1000)
+        nat = quantile_estimation('nat', data)
+        stream = quantile_estimation('str', data, compression=100.)
+        for p in [.1, .5, .9]:
+            self.assertAlmostEqual(stream.quantile(p), nat.quantile(p), delta=.1)
+
+    @classmethod
+    def tearDownClass(cls):
+        """Test data deletion"""
+        del cls._udata, cls._mdata
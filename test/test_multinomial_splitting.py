@@ -4,6 +4,7 @@ from statiskit import linalg
 from statiskit import core
 
 import unittest
+import math
 from nose.plugins.attrib import attr
 
 @attr(linux=True,
@@ -18,9 +19,43 @@ class TestMultinomialSplitting(unittest.TestCase, AbstractTestDiscreteMultivaria
         cls._dist = core.MultinomialSplittingDistribution(core.BinomialDistribution(5, .5),
                                                           linalg.Vector([.25, .75]))
 
+    def test_probability(self):
+        """Test multinomial splitting log-probability"""
+        lp = core.BinomialDistribution(5, .5).probability(3, log=True)
+        lp += math.lgamma(4) - math.lgamma(3) - math.lgamma(2) + 2 * math.log(.25) + math.log(.75)
+        self.assertAlmostEqual(self._dist.probability(2, 1, log=True), lp)
+        event = core.VectorEvent(2)
+        event[0] = core.DiscreteElementaryEvent(2)
+        lp = core.BinomialDistribution(5, .5).probability(2, log=True) + 2 * math.log(.25)
+        self.assertAlmostEqual(self._dist.probability(event, log=True), lp)
+        data = self._dist.simulation(20)
+        self.assertAlmostEqual(self._dist.loglikelihood(data), sum(self._dist.probability(event, log=True) for event in data.events))
+
     def test_estimation(self):
         """Test multinomial splitting estimation"""
         data = self._dist.simulation(100)
         est = core.multinomial_splitting_estimation(data,
                                                     sum=core.binomial_estimation('ml'))
-        self.assertGreaterEqual(est.estimated.loglikelihood(data), self._dist.loglikelihood(data))
\ No newline at end of file
+        self.assertGreaterEqual(est.estimated.loglikelihood(data), self._dist.loglikelihood(data))
+
+    def test_compress(self):
+        """Test multinomial splitting estimation with compressed sums"""
+        data = self._dist.simulation(100)
+        est = core.multinomial_splitting_estimation(data,
+                                                    sum=core.binomial_estimation('ml'))
+        _est = core.multinomial_splitting_estimation(data,
+                                                     sum=core.binomial_estimation('ml'),
+                                                     compress=True)
+        self.assertAlmostEqual(est.estimated.loglikelihood(data), _est.estimated.loglikelihood(data))
+
+    def test_independent(self):
+        """Test independent estimation of multinomial splitting data"""
+        data = self._dist.simulation(100)
+        llh = sum(core.poisson_estimation('ml', component).estimated.loglikelihood(component) for component in data.components)
+        nb_threads = core.get_nb_threads()
+        for threads in [1, 3]:
+            core.set_nb_threads(threads)
+            est = core.independent_estimation(data,
+                                              default_estimator=core.poisson_estimation('ml'))
+            self.assertAlmostEqual(est.estimated.loglikelihood(data), llh)
+        core.set_nb_threads(nb_threads)
@@ -1,4 +1,5 @@
 from statiskit import linalg, core
+from statiskit.core.moment import covariance_matrix_estimation
 
 import unittest
 from nose.plugins.attrib import attr
@@ -20,6 +21,17 @@ class TestMultinormal(unittest.TestCase):
         """Test multinormal distribution simulation"""
         data = self._dist.simulation(20)
 
+    def test_covariance(self):
+        """Test blocked natural covariance matrix estimation"""
+        data = self._dist.simulation(50)
+        covariance = covariance_matrix_estimation('nat', data).covariance
+        _covariance = covariance_matrix_estimation('nat', data, block=7).covariance
+        for i in range(3):
+            self.assertAlmostEqual(covariance[i, i], data.components[i].variance)
+            for j in range(3):
+                self.assertAlmostEqual(covariance[i, j], _covariance[i, j])
+                self.assertAlmostEqual(covariance[i, j], covariance[j, i])
+
     @classmethod
     def tearDownClass(cls):
         """Test distribution deletion"""
@@ -22,6 +22,14 @@ class TestNegativeBinomial(unittest.TestCase, AbstractTestDiscreteUnivariateDist
         mle = core.negative_binomial_estimation('ml', data)
         self.assertGreaterEqual(mle.estimated.loglikelihood(data), self._dist.loglikelihood(data))
 
+    def test_mle_underdispersion(self):
+        """Test negative binomial ML estimation on constant data"""
+        data = core.UnivariateDataFrame(core.controls.ZZ)
+        for value in [3, 3, 3]:
+            data.add_event(core.DiscreteElementaryEvent(value))
+        with self.assertRaises(RuntimeError):
+            core.negative_binomial_estimation('ml', data)
+
     def test_mme(self):
         """Test negative binomial MM estimation"""
         data = self._dist.simulation(100)
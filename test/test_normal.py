@@ -22,6 +22,12 @@ class TestNormal(unittest.TestCase, AbstractTestContinuousUnivariateDistribution
         mle = core.normal_estimation('ml', data)
         self.assertGreaterEqual(mle.estimated.loglikelihood(data), self._dist.loglikelihood(data))
 
+    def test_mle_empty(self):
+        """Test normal ML estimation on empty data"""
+        data = core.UnivariateDataFrame(core.controls.RR)
+        with self.assertRaises(RuntimeError):
+            core.normal_estimation('ml', data)
+
     @classmethod
     def tearDownClass(cls):
         """Test distribution deletion"""
@@ -1,6 +1,7 @@
 from test_distribution import AbstractTestDiscreteUnivariateDistribution
 
 from statiskit import core
+from statiskit.core.estimation import UnivariateDataStatistic
 
 import unittest
 from nose.plugins.attrib import attr
@@ -20,4 +21,28 @@ class TestBinomial(unittest.TestCase, AbstractTestDiscreteUnivariateDistribution
         """Test Poisson ML estimation"""
         data = self._dist.simulation(10)
         mle = core.poisson_estimation('ml', data)
-        self.assertGreaterEqual(mle.estimated.loglikelihood(data), self._dist.loglikelihood(data))
\ No newline at end of file
+        self.assertGreaterEqual(mle.estimated.loglikelihood(data), self._dist.loglikelihood(data))
+
+    def test_mle_empty(self):
+        """Test Poisson ML estimation on empty data"""
+        data = core.UnivariateDataFrame(core.controls.ZZ)
+        with self.assertRaises(RuntimeError):
+            core.poisson_estimation('ml', data)
+
+    def test_statistic(self):
+        """Test estimation from sufficient statistics"""
+        data = self._dist.simulation(20)
+        mle = core.poisson_estimation('ml', data)
+        estimator = core.poisson_estimation('ml')
+        moments = estimator.statistic()
+        events = UnivariateDataStatistic(data.sample_space)
+        for event in data.events:
+            moments.update(event, 1.)
+            events.update(event, 1.)
+        self.assertAlmostEqual(estimator(moments).estimated.theta, mle.estimated.theta)
+        self.assertAlmostEqual(estimator(events).estimated.theta, mle.estimated.theta)
+        estimator = core.binomial_estimation('ml')
+        self.assertIsNone(estimator.statistic())
+        self.assertEqual(estimator(events).estimated.loglikelihood(data), core.binomial_estimation('ml', data).estimated.loglikelihood(data))
+        with self.assertRaises(RuntimeError):
+            estimator(moments)
@@ -1,6 +1,8 @@
+from statiskit import linalg
 from statiskit import core
 
 import unittest
+import math
 from nose.plugins.attrib import attr
 
 @attr(linux=True,
@@ -42,6 +44,50 @@ class TestCriteria(unittest.TestCase):
                                                                    core.negative_binomial_estimation("ml")])
         # self.assertGreaterEqual(bic.estimated.loglikelihood(data), self._dist.loglikelihood(data))
 
+    def test_threads(self):
+        """Test selection independence from the number of threads"""
+        estimators = [core.binomial_estimation("ml"),
+                      core.poisson_estimation("ml"),
+                      core.negative_binomial_estimation("ml")]
+        nb_threads = core.get_nb_threads()
+        core.set_nb_threads(1)
+        sequential = core.selection(self._data, "criterion", "BIC", estimators=estimators)
+        core.set_nb_threads(len(estimators))
+        parallel = core.selection(self._data, "criterion", "BIC", estimators=estimators)
+        core.set_nb_threads(nb_threads)
+        for score, _score in zip(sequential.scores, parallel.scores):
+            self.assertEqual(score, _score)
+        self.assertEqual(sequential.estimated.loglikelihood(self._data), parallel.estimated.loglikelihood(self._data))
+
+    def test_multivariate_bic(self):
+        """Test BIC selection of multivariate distributions"""
+        data = core.MultinomialSplittingDistribution(core.PoissonDistribution(5.), linalg.Vector([.25, .75])).simulation(100)
+        bic = core.selection(data, "criterion", estimators=[core.multinomial_splitting_estimation(sum=core.poisson_estimation("ml")),
+                                                            core.multinomial_splitting_estimation(sum=core.binomial_estimation("ml"))])
+        for estimation, score in zip(bic.estimations, bic.scores):
+            self.assertAlmostEqual(score, estimation.estimated.loglikelihood(data) - estimation.estimated.nb_parameters * math.log(100.) / 2.)
+
+    def test_cv(self):
+        """Test cross-validation selection"""
+        cv = core.selection(self._data, "cv", nb_folds=5, estimators=[core.binomial_estimation("ml"),
+                                                                        core.poisson_estimation("ml"),
+                                                                        core.negative_binomial_estimation("ml")])
+        best = max(score for score in cv.scores if not math.isnan(score))
+        self.assertLess(best, 0.)
+        self.assertIn(cv.estimated.loglikelihood(self._data), [estimation.estimated.loglikelihood(self._data) for estimation, score in zip(cv.estimations, cv.scores) if score == best])
+
+    def test_cv_early_stopping(self):
+        """Test cross-validation selection with early stopping"""
+        data = core.BinomialDistribution(10, .5).simulation(1000)
+        estimators = [core.binomial_estimation("ml"),
+                      core.poisson_estimation("ml")]
+        cv = core.selection(data, "cv", nb_folds=5, estimators=estimators)
+        self.assertFalse(any(math.isnan(score) for score in cv.scores))
+        cv = core.selection(data, "cv", nb_folds=5, early_stopping=2, estimators=estimators)
+        self.assertEqual(len(cv.scores), 2)
+        self.assertFalse(math.isnan(cv.scores[0]))
+        self.assertTrue(math.isnan(cv.scores[1]))
+
     @classmethod
     def tearDownClass(cls):
         """Test data deletion"""
@@ -1,6 +1,7 @@
 import matplotlib
 matplotlib.use('Agg')
 
+from statiskit import linalg
 from statiskit import core
 from statiskit.data import core as data
 
@@ -24,6 +25,38 @@ class TestSlopeHeuristic(unittest.TestCase):
         sh = core.SlopeHeuristic([pen.value for pen in self._data.pen.events], [-contrast.value for contrast in self._data.contrast.events])
         sh.plot()
 
+    def test_ols_path(self):
+        """Test slope heuristic least squares regressions along the penalty path"""
+        self.check_path(core.SlopeHeuristicOLSSolver())
+
+    def test_iwls_path(self):
+        """Test slope heuristic robust regressions along the penalty path"""
+        self.check_path(core.SlopeHeuristicBiSquareSolver())
+
+    def check_path(self, solver):
+        """Compare path regressions with independent regressions on the same points"""
+        sh = core.SlopeHeuristic([pen.value for pen in self._data.pen.events], [-contrast.value for contrast in self._data.contrast.events],
+                                 solver, core.SlopeHeuristicMaximalSelector())
+        penshapes, scores = sh.penshapes[:], sh.scores[:]
+        for index in range(1, len(scores) - 1):
+            beta = solver(linalg.Matrix([[1., penshape] for penshape in penshapes[-index - 1:]]), linalg.Vector(scores[-index - 1:]))
+            self.assertAlmostEqual(sh.intercepts[index], beta[0], delta=1e-6 * max(1., abs(beta[0])))
+            self.assertAlmostEqual(sh.slopes[index], beta[1], delta=1e-6 * max(1., abs(beta[1])))
+
+    def test_selection(self):
+        """Test slope heuristic selection among estimators"""
+        data = core.NormalDistribution().simulation(100)
+        selections = []
+        for lazy_proposals in [False, True]:
+            estimator = core.selection(core.outcome_type.CONTINUOUS, 'sh', lazy_proposals=lazy_proposals)
+            for nb_bins in range(1, 21):
+                estimator.add_estimator(float(nb_bins), core.histogram_estimation(False, 'cla', nb_bins=nb_bins))
+            selections.append(estimator(data, False))
+        for index in range(len(selections[0].scores)):
+            self.assertEqual(selections[0].scores[index], selections[1].scores[index])
+            self.assertAlmostEqual(selections[1].proposals[index].loglikelihood(data), selections[1].scores[index])
+        self.assertEqual(selections[0].estimated.loglikelihood(data), selections[1].estimated.loglikelihood(data))
+
     @classmethod
     def tearDownClass(cls):
         """Test multivariate data deletion"""
@@ -0,0 +1,60 @@
+from test_distribution import AbstractTestContinuousUnivariateDistribution
+
+from statiskit import core
+
+import unittest
+import numpy
+from nose.plugins.attrib import attr
+
+@attr(linux=True,
+      osx=True,
+      win=True,
+      level=1)
+class TestNonStandardStudent(unittest.TestCase, AbstractTestContinuousUnivariateDistribution):
+
+    @classmethod
+    def setUpClass(cls):
+        """Test non-standard Student distribution construction"""
+        cls._dist = core.NonStandardStudentDistribution(1., 2., 3.)
+
+    def test_mle(self):
+        """Test non-standard Student ML estimation"""
+        data = self._dist.simulation(100)
+        mle = core.student_estimation('ml', data)
+        self.assertGreaterEqual(mle.estimated.loglikelihood(data), self._dist.loglikelihood(data))
+
+    def test_pdf_integration(self):
+        """Test non-standard Student probability density function integration"""
+        x = numpy.linspace(self._dist.quantile(1e-6), self._dist.quantile(1. - 1e-6), num=100001)
+        self.assertAlmostEqual(numpy.trapz([self._dist.pdf(v) for v in x], x), 1., places=4)
+
+    def test_cdf_quantile(self):
+        """Test non-standard Student quantile as the inverse of the cumulative distribution function"""
+        for v in numpy.linspace(-10., 10., num=21):
+            self.assertAlmostEqual(self._dist.quantile(self._dist.cdf(v)), v, places=5)
+
+    @classmethod
+    def tearDownClass(cls):
+        """Test non-standard Student distribution deletion"""
+        del cls._dist
+
+@attr(linux=True,
+      osx=True,
+      win=True,
+      level=1)
+class TestGeneralizedStudent(unittest.TestCase, AbstractTestContinuousUnivariateDistribution):
+
+    @classmethod
+    def setUpClass(cls):
+        """Test generalized Student distribution construction"""
+        cls._dist = core.GeneralizedStudentDistribution(1., 2., 3., 1.)
+
+    def test_cdf_quantile(self):
+        """Test generalized Student quantile as the inverse of the cumulative distribution function"""
+        for v in numpy.linspace(-10., 10., num=21):
+            self.assertAlmostEqual(self._dist.quantile(self._dist.cdf(v)), v, places=5)
+
+    @classmethod
+    def tearDownClass(cls):
+        """Test generalized Student distribution deletion"""
+        del cls._dist